@@ -0,0 +1,200 @@
+// Benchmark for the MD_TTT auto player engines
+//
+// Measures the time taken by each auto player engine to make a move 
+// and the number of positions per second searched by the search engine, 
+// then plays the engines against each other and against a random 
+// player to compare the quality of their moves.
+//
+// Results are printed to the Serial console. The perfect play table 
+// engine is included if TTT_USE_TABLE is enabled in MD_TTT.h, and the 
+// search engine with a transposition table if TTT_USE_HASH is enabled.
+//
+#include <MD_TTT.h>
+
+#define GAMES 100   // number of games for each test
+#define RANDOM_PLAYER 0xff  // not an engine, plays random moves
+#define TT_ENTRIES  128     // transposition table size for the search engine
+
+// function prototype
+void tttCallback(uint8_t position, int8_t player);
+
+MD_TTT  TTT[2] = { MD_TTT(tttCallback), MD_TTT(tttCallback) };
+
+uint8_t lastMove;   // the last move made, set by the callback
+
+#if TTT_USE_HASH
+tttTransEntry transTable[TT_ENTRIES];
+#endif
+
+void tttCallback(uint8_t position, int8_t player)
+{
+  if (player != TTT_P0)
+    lastMove = position;
+}
+
+uint8_t randomMove(MD_TTT &G)
+// pick a random empty cell
+{
+  uint8_t m;
+
+  do
+    m = random(TTT_BOARD_SIZE);
+  while (G.getBoardPosition(m) != TTT_P0);
+
+  return(m);
+}
+
+const __FlashStringHelper *engineName(uint8_t engine)
+{
+  switch (engine)
+  {
+  case TTT_ENGINE_HEURISTIC: return(F("Heuristic"));
+  case TTT_ENGINE_TABLE:     return(F("Table"));
+  case TTT_ENGINE_SEARCH:    return(F("Search"));
+  case RANDOM_PLAYER:        return(F("Random"));
+  default:                   return(F("?"));
+  }
+}
+
+void timeEngine(uint8_t engine, bool useTT = false)
+// Play games against a random player and time the auto player moves
+{
+  uint32_t moves = 0, nodes = 0, elapsed = 0;
+  uint32_t probes = 0, hits = 0;
+  int8_t curPlayer;
+
+  TTT[0].setAutoPlayer(TTT_P1, engine);
+#if TTT_USE_HASH
+  TTT[0].setTransTable(useTT ? transTable : NULL, sizeof(transTable));
+#endif
+
+  for (uint16_t g=0; g<GAMES; g++)
+  {
+    TTT[0].start();
+    curPlayer = (g & 1) ? TTT_P1 : TTT_P2;
+
+    while (!TTT[0].isGameOver())
+    {
+      if (curPlayer == TTT_P1)
+      {
+        uint32_t t = micros();
+
+        TTT[0].doMove(0, curPlayer);
+        elapsed += micros() - t;
+        nodes += TTT[0].getSearchNodes();
+#if TTT_USE_HASH
+        probes += TTT[0].getTransProbes();
+        hits += TTT[0].getTransHits();
+#endif
+        moves++;
+      }
+      else
+        TTT[0].doMove(randomMove(TTT[0]), curPlayer);
+
+      curPlayer = -curPlayer;
+    }
+  }
+
+  Serial.print(F("\n"));
+  Serial.print(engineName(engine));
+  if (useTT) Serial.print(F("+TT"));
+  Serial.print(F(": "));
+  Serial.print(elapsed / moves);
+  Serial.print(F(" us/move"));
+  if (engine == TTT_ENGINE_SEARCH)
+  {
+    Serial.print(F(", "));
+    Serial.print(nodes / moves);
+    Serial.print(F(" nodes/move, "));
+    Serial.print((uint32_t)(((float)nodes * 1000000.0) / elapsed));
+    Serial.print(F(" nodes/s"));
+  }
+  if (useTT && probes != 0)
+  {
+    Serial.print(F(", TT hit rate "));
+    Serial.print((100 * hits) / probes);
+    Serial.print(F("%"));
+  }
+
+#if TTT_USE_HASH
+  TTT[0].setTransTable(NULL, 0);
+#endif
+}
+
+void playMatch(uint8_t engine1, uint8_t engine2)
+// Play games between two engines, alternating the first player
+{
+  uint16_t result[3] = { 0, 0, 0 };  // engine2 wins, draws, engine1 wins
+  int8_t curPlayer;
+
+  // each engine has its own copy of the game, and the random player 
+  // has no auto player as RANDOM_PLAYER is not a library engine
+  if (engine1 == RANDOM_PLAYER) TTT[0].setAutoPlayer(TTT_P0);
+  else TTT[0].setAutoPlayer(TTT_P1, engine1);
+  if (engine2 == RANDOM_PLAYER) TTT[1].setAutoPlayer(TTT_P0);
+  else TTT[1].setAutoPlayer(TTT_P2, engine2);
+
+  for (uint16_t g=0; g<GAMES; g++)
+  {
+    TTT[0].start();
+    TTT[1].start();
+    curPlayer = (g & 1) ? TTT_P1 : TTT_P2;
+
+    while (!TTT[0].isGameOver())
+    {
+      uint8_t e = (curPlayer == TTT_P1 ? engine1 : engine2);
+      MD_TTT &G = TTT[curPlayer == TTT_P1 ? 0 : 1];
+      MD_TTT &O = TTT[curPlayer == TTT_P1 ? 1 : 0];
+
+      lastMove = (e == RANDOM_PLAYER ? randomMove(G) : 0);
+      G.doMove(lastMove, curPlayer);  // auto player unless random
+      O.doMove(lastMove, curPlayer);  // keep the other game in step
+      curPlayer = -curPlayer;
+    }
+
+    result[TTT[0].getGameWinner() + 1]++;
+  }
+
+  Serial.print(F("\n"));
+  Serial.print(engineName(engine1));
+  Serial.print(F(" v "));
+  Serial.print(engineName(engine2));
+  Serial.print(F(": W "));
+  Serial.print(result[2]);
+  Serial.print(F(" D "));
+  Serial.print(result[1]);
+  Serial.print(F(" L "));
+  Serial.print(result[0]);
+}
+
+void setup() 
+{
+  Serial.begin(57600);
+  Serial.println(F("\n[TTT Benchmark Example]"));
+
+  randomSeed(analogRead(A0));
+
+  Serial.print(F("\n-- Time per move v random player, "));
+  Serial.print(GAMES);
+  Serial.print(F(" games"));
+  timeEngine(TTT_ENGINE_HEURISTIC);
+  timeEngine(TTT_ENGINE_SEARCH);
+#if TTT_USE_HASH
+  timeEngine(TTT_ENGINE_SEARCH, true);
+#endif
+#if TTT_USE_TABLE
+  timeEngine(TTT_ENGINE_TABLE);
+#endif
+
+  Serial.print(F("\n\n-- Move quality, "));
+  Serial.print(GAMES);
+  Serial.print(F(" games"));
+  playMatch(TTT_ENGINE_HEURISTIC, RANDOM_PLAYER);
+  playMatch(TTT_ENGINE_SEARCH, RANDOM_PLAYER);
+  playMatch(TTT_ENGINE_SEARCH, TTT_ENGINE_HEURISTIC);
+  Serial.println();
+}
+
+void loop(void)
+{
+}
@@ -4,20 +4,39 @@
 // Game play using the MD_TTT library and
 // non-blocking user input so we can do other stuff!
 //
+// The board is drawn whenever its generation changes. On a terminal 
+// that understands ANSI escape codes (eg, PuTTY or screen, but not the 
+// Arduino Serial Monitor) set ANSI_TERMINAL to 1. The board then stays 
+// at the top of the screen and only the changed cells are sent, about 
+// 20 bytes for a move rather than 124 for the whole board.
+//
 #include <MD_TTT.h>
 
+#define ANSI_TERMINAL 0
+
+#define ESC "\x1b"
+
 // function prototype
 void tttCallback(uint8_t position, int8_t player);
 
 char    player[] = { 'O', ' ', 'X' };
 int8_t  curPlayer = TTT_P1;
 bool    inGamePlay = false;
+uint16_t boardGen = 0;  // the board generation last drawn
 
 MD_TTT  TTT(tttCallback);
 
 void setup() 
 {
   Serial.begin(57600);
+#if ANSI_TERMINAL
+  // draw the empty grid at the top of the screen and scroll the text below it
+  Serial.print(F(ESC "[2J" ESC "[1;1H"));
+  Serial.print(F("   |   |        |   |  \r\n---+---+---  ---+---+---\r\n"));
+  Serial.print(F("   |   |        |   |  \r\n---+---+---  ---+---+---\r\n"));
+  Serial.print(F("   |   |        |   |  "));
+  Serial.print(F(ESC "[7r" ESC "[7;1H"));
+#endif
   Serial.println(F("\n[TTT Console Example]\n"));
 
   TTT.setAutoPlayer(curPlayer);
@@ -39,6 +58,20 @@ void clearInput()
     Serial.read();
 }
 
+void showHint(void)
+// show the moves the computer would choose between
+{
+  tttMoveInfo moves[TTT_BOARD_SIZE];
+  uint8_t n = TTT.analyze(curPlayer, moves, TTT_BOARD_SIZE);
+
+  Serial.print(F("\nHint:"));
+  for (uint8_t i=0; i<n && moves[i].best; i++)
+  {
+    Serial.print(' ');
+    Serial.print((char)('a' + moves[i].cell));
+  }
+}
+
 uint8_t getMove(void)
 // get the next move from the player
 // there may not be a move there so we need to split the 
@@ -51,7 +84,7 @@ uint8_t getMove(void)
 
   if (promptMode)
   {
-    Serial.print(F("\nYour move? (a-i): "));
+    Serial.print(F("\nYour move? (a-i, ? for a hint): "));
     clearInput();
     promptMode = false;
   }
@@ -62,7 +95,9 @@ uint8_t getMove(void)
     if (c != 0xff)
     {
       Serial.print((char)c);
-      if (c>='A' && c<='I')
+      if (c == '?')
+        showHint();
+      else if (c>='A' && c<='I')
       {
         m = c - 'A';
         if (TTT.getBoardPosition(m) != TTT_P0)
@@ -82,7 +117,33 @@ void tttCallback(uint8_t position, int8_t player)
     Serial.print("\nComputer move: ");
     Serial.print((char)(position+'A'));
   }
-  displayBoard();
+}
+
+void displayDelta(void)
+// Send only the cells that changed since the board was last drawn. 
+// Each cell is the player and the cell id, placed with cursor moves 
+// while the text cursor is saved.
+{
+  uint16_t dirty = TTT.getDirty();
+
+  Serial.print(F(ESC "7"));
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+  {
+    if (!(dirty & (1 << i)))
+      continue;
+
+    int8_t p = TTT.getBoardPosition(i);
+
+    Serial.print(F(ESC "["));
+    Serial.print(1 + 2*(i/3));  // row
+    Serial.print(';');
+    Serial.print(2 + 4*(i%3));  // column
+    Serial.print('H');
+    Serial.print(player[p+1]);
+    Serial.print(F(ESC "[12C"));  // across to the cell id
+    Serial.print((p == TTT_P0) ? CELL_ID(i) : ' ');
+  }
+  Serial.print(F(ESC "8"));
 }
 
 void displayBoard(void)
@@ -120,7 +181,6 @@ void TTT_FSM()
   {
   case 0: // initialise for a new game
     inGamePlay = TTT.start();
-    displayBoard();
     curState++;
     break;
 
@@ -184,7 +244,23 @@ void TTT_FSM()
   }
 }
 
+void updateDisplay(void)
+// draw the board if it has changed since it was last drawn
+{
+  if (TTT.getGeneration() == boardGen)
+    return;
+
+  boardGen = TTT.getGeneration();
+#if ANSI_TERMINAL
+  displayDelta();
+#else
+  displayBoard();
+#endif
+  TTT.clearDirty();
+}
+
 void loop(void)
 {
+  updateDisplay();
   TTT_FSM();
 }
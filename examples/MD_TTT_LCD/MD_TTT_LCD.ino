@@ -8,7 +8,10 @@
 // cell.
 //
 // Game play using the MD_TTT library and non-blocking user input 
-// so we can do other stuff!
+// so we can do other stuff! If TTT_USE_EVENTS is enabled in MD_TTT.h 
+// the board is drawn from the library event queue, one event each time 
+// through loop(), so the game never waits for the LCD. Otherwise it is 
+// drawn by the move callback.
 //
 // LCD libraries used in this example are fm version of the 
 // libraries found at 
@@ -20,7 +23,7 @@
 #include "MD_TTT_LCD.h"
 
 // function prototype
-void tttCallback(uint8_t position, int8_t player);
+void displayPosition(uint8_t pos, int8_t player);
 
 // User switches for gameplay
 #define SWITCH_SELECT 3 // pin for the switch that moves from one selection to another
@@ -53,7 +56,12 @@ swState swSelect = { SWITCH_SELECT, false, 0 };
 
 // Main objects used defined here
 LiquidCrystal_SR lcd(LCD_DTA_PIN, LCD_CLK_PIN);
-MD_TTT TTT(tttCallback);
+#if TTT_USE_EVENTS
+MD_TTT TTT(NULL);
+uint8_t tttEvents[16];  // game event queue
+#else
+MD_TTT TTT(displayPosition);
+#endif
 
 int8_t  curPlayer = TTT_P2;
 bool  inGamePlay = false;
@@ -78,6 +86,9 @@ void setup()
   lcd.createChar(P2token[1], p2_5);
   lcd.createChar(separator[0], sep_7);
 
+#if TTT_USE_EVENTS
+  TTT.setEventQueue(tttEvents, sizeof(tttEvents));
+#endif
   TTT.setAutoPlayer(curPlayer);
 
   delay(1000);  //allow time to display
@@ -171,11 +182,6 @@ uint8_t getMove(void)
   return(m);
 }
 
-void tttCallback(uint8_t position, int8_t player)
-{
-  displayPosition(position, player);
-}
-
 void displayPosition(uint8_t pos, int8_t player)
 // update the board position with the player token
 {
@@ -250,7 +256,9 @@ void TTT_FSM()
   switch (curState)
   {
   case gStart: // initialize for a new game
-    displayGrid();
+#if !TTT_USE_EVENTS
+    displayGrid();  // otherwise drawn by the event
+#endif
     inGamePlay = TTT.start();
     curState = gGetMove;
     break;
@@ -304,7 +312,41 @@ void TTT_FSM()
   }
 }
 
+#if TTT_USE_EVENTS
+void displayEvent(void)
+// draw the next change from the game event queue, if any
+{
+  tttEvent e;
+
+  if (!TTT.getEvent(&e))
+    return;
+
+  switch (e.type)
+  {
+  case TTT_EVT_CLEAR:
+    displayGrid();
+    break;
+
+  case TTT_EVT_CELL:
+    displayPosition(e.pos, e.player);
+    break;
+
+  case TTT_EVT_SYNC:  // events were lost, draw everything
+    displayGrid();
+    for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+      displayPosition(i, TTT.getBoardPosition(i));
+    break;
+
+  default:  // game over is handled by TTT_FSM()
+    break;
+  }
+}
+#endif
+
 void loop(void)
 {
+#if TTT_USE_EVENTS
+  displayEvent();
+#endif
   TTT_FSM();
 }
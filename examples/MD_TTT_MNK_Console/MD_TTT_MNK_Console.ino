@@ -0,0 +1,178 @@
+// 4x4 Tic Tac Toe (4 in a row) using the console for input/output
+//
+// Input and output using the Serial console.
+// Game play using the MD_TTT_MNK template from the MD_TTT library
+// and non-blocking user input so we can do other stuff!
+//
+// Change the ROWS, COLS and K_IN_ROW defines to play other m,n,k games.
+//
+#include <MD_TTT_MNK.h>
+
+#define ROWS      4   // board rows
+#define COLS      4   // board columns
+#define K_IN_ROW  4   // number in a row to win
+
+typedef MD_TTT_MNK<ROWS, COLS, K_IN_ROW> Game;
+
+// function prototype
+void tttCallback(Game::cell_t position, int8_t player);
+
+char    player[] = { 'O', '.', 'X' };
+int8_t  curPlayer = TTT_P1;
+bool    inGamePlay = false;
+
+Game  TTT(tttCallback);
+
+void setup()
+{
+  Serial.begin(57600);
+  Serial.println(F("\n[TTT MNK Console Example]\n"));
+
+  TTT.setAutoPlayer(curPlayer);
+}
+
+uint8_t getMove(void)
+// get the next move from the player as a column letter and row
+// number (eg, b3). Return 0xff if no move entered.
+{
+  static bool promptMode = true;
+  static char col = 0;
+
+  uint8_t m = 0xff;
+
+  if (promptMode)
+  {
+    Serial.print(F("\nYour move? (eg a1): "));
+    while (Serial.available() > 0)
+      Serial.read();
+    col = 0;
+    promptMode = false;
+  }
+  else if (Serial.available() > 0)
+  {
+    char c = toupper(Serial.read());
+
+    Serial.print(c);
+    if (col == 0)
+    {
+      if (c >= 'A' && c < 'A' + COLS)
+        col = c;
+      else
+        promptMode = true;
+    }
+    else
+    {
+      if (c >= '1' && c < '1' + ROWS)
+      {
+        m = ((c - '1') * COLS) + (col - 'A');
+        if (TTT.getBoardPosition(m) != TTT_P0)
+          m = 0xff;
+      }
+      promptMode = true;
+    }
+  }
+
+  return(m);
+}
+
+void tttCallback(Game::cell_t position, int8_t player)
+{
+  if (player == TTT.getAutoPlayer())
+  {
+    Serial.print(F("\nComputer move: "));
+    Serial.print((char)('a' + (position % COLS)));
+    Serial.print((position / COLS) + 1);
+    Serial.print(F(" ("));
+    Serial.print(TTT.getSearchNodes());
+    Serial.print(F(" nodes)"));
+  }
+  if (player != TTT_P0)
+    displayBoard();
+}
+
+void displayBoard(void)
+{
+  if (!inGamePlay)
+    return;
+
+  Serial.print(F("\n  "));
+  for (uint8_t c=0; c<COLS; c++)
+  {
+    Serial.print(' ');
+    Serial.print((char)('a' + c));
+  }
+
+  for (uint8_t r=0; r<ROWS; r++)
+  {
+    Serial.print('\n');
+    Serial.print(r + 1);
+    Serial.print(' ');
+    for (uint8_t c=0; c<COLS; c++)
+    {
+      Serial.print(' ');
+      Serial.print(player[TTT.getBoardPosition((r * COLS) + c) + 1]);
+    }
+  }
+  Serial.println();
+}
+
+void TTT_FSM()
+{
+  static uint8_t curState = 0;  // current state
+
+  switch (curState)
+  {
+  case 0: // initialise for a new game
+    inGamePlay = TTT.start();
+    displayBoard();
+    curState++;
+    break;
+
+  case 1: // get and make player move - this section is non-blocking
+    {
+      uint8_t m = 0;
+
+      if (TTT.getAutoPlayer() != curPlayer)
+        m = getMove();
+
+      if (m != 0xff)
+      {
+        TTT.doMove(m, curPlayer);
+        curState++;
+      }
+    }
+    break;
+
+  case 2: // switch players and check if this is the end of the game
+    if (TTT.isGameOver())
+    {
+      inGamePlay = false;
+
+      Serial.print(F("\nGAME OVER!! "));
+      if (TTT.getGameWinner() == TTT_P0)
+        Serial.print(F("It's a draw."));
+      else if (TTT.getGameWinner() == TTT.getAutoPlayer())
+        Serial.print(F("I win!"));
+      else
+        Serial.print(F("You win. Congratulations!"));
+      Serial.print(F("\nLet's play again...\n"));
+
+      curState = 0;
+    }
+    else
+      curState = 1;
+
+    // switch turns for players
+    curPlayer = (curPlayer == TTT_P1 ? TTT_P2 : TTT_P1);
+    break;
+
+  default:
+    curState = 0;
+    break;
+  }
+}
+
+void loop(void)
+{
+  TTT_FSM();
+}
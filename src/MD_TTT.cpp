@@ -21,39 +21,93 @@
 */
 
 #include <MD_TTT.h>
+#include "MD_TTT_lib.h"
 
-#define  DEBUG_TTT  0
+// The game tables are generated from the board geometry in MD_TTT_lib.h 
+// and are constant for all games, so they are shared by all MD_TTT 
+// objects and kept in program memory.
+#define SYM_CELL(s, k)  tttSymCell(s, (k) / 3, (k) % 3)
+#define SYM_ROW(s)  { SYM_CELL(s, 0), SYM_CELL(s, 1), SYM_CELL(s, 2), SYM_CELL(s, 3), SYM_CELL(s, 4), SYM_CELL(s, 5), SYM_CELL(s, 6), SYM_CELL(s, 7), SYM_CELL(s, 8) }
 
-#if  DEBUG_TTT
-#define  DEBUG(s, v)  { Serial.print(F(s)); Serial.print(v); }
-#define  DEBUGS(s)    Serial.print(F(s))
-#else
-#define  DEBUG(s, v)
-#define  DEBUGS(s)
-#endif
+// The game win weight matrix - see documentation for meaning of bits.
+const uint8_t TTT_wwm[TTT_BOARD_SIZE] PROGMEM = TTT_CELL_TABLE(tttCellLines);
+
+// The cells in each winning line as a bitboard mask
+const uint16_t TTT_wlm[TTT_WIN_LINES] PROGMEM = TTT_LINE_TABLE(tttLineMask);
 
-// The game win weight matrix - see documentation for meaning of bits
-uint8_t	wwm[TTT_BOARD_SIZE] = 
-{
-// D1 H1 H2 H3 V1 V2 V3 D2 in order
-  0b11001000, // a
-  0b01000100, // b
-  0b01000011, // c
-  0b00101000, // d
-  0b10100101, // e
-  0b00100010, // f
-  0b00011001, // g
-  0b00010100, // h
-  0b10010010  // i
+// Board symmetries. For each of the rotations and reflections of the 
+// board, the cell that each cell [a..i] maps onto.
+const uint8_t TTT_sym[TTT_SYMMETRIES][TTT_BOARD_SIZE] PROGMEM =
+{
+  SYM_ROW(0), SYM_ROW(1), SYM_ROW(2), SYM_ROW(3),
+  SYM_ROW(4), SYM_ROW(5), SYM_ROW(6), SYM_ROW(7)
 };
 
-// Current state of the game
-int8_t currState[8];
+// Check the geometry against the documented win weight matrix
+static_assert(tttCellLines(0) == 0b11001000 && tttCellLines(4) == 0b10100101 && tttCellLines(8) == 0b10010010, "win weight matrix");
+static_assert(tttLineMask(TTT_WL_D2) == 0b001010100 && tttLineMask(TTT_WL_V3) == 0b100100100, "win line masks");
+static_assert(SYM_CELL(1, 0) == 2 && SYM_CELL(3, 1) == 3 && SYM_CELL(7, 1) == 5, "board symmetries");
+
+// Zobrist hash keys for TTT_P1 and TTT_P2 in each cell
+const uint32_t TTT_zobrist[2][TTT_BOARD_SIZE] PROGMEM =
+{
+  { 0x6cd86da8UL, 0xd40b358cUL, 0x0d49c430UL, 0xdb44a7fcUL, 0x66dbc205UL, 0xce11399aUL, 0xe68ed9a1UL, 0x56e03250UL, 0xc174433bUL },
+  { 0xd71f34b5UL, 0x6382c7b6UL, 0x9222f5dbUL, 0x83538df9UL, 0x731fde50UL, 0x68db6d5dUL, 0xc48827aaUL, 0x8dda4ba1UL, 0xbf3396efUL }
+};
+
+#define RANDOM_DEFAULT  0x2545f491UL  ///< random state used for an invalid state
+
+#if TTT_USE_TABLE
+// Perfect play table - see tools/MD_TTT_TableGen.cpp for the format
+extern const uint8_t TTT_perfectTable[] PROGMEM;
 
+#define TABLE_INVALID   0xff  ///< the board cannot occur in a game
+#define TABLE_MOVE(e)   ((e) & 0xf)
+#define TABLE_VALUE(e)  ((int8_t)(((e) >> 4) & 0x3) - 1)
+#endif
+
+#if TTT_USE_BOOK
+// Opening book - see tools/MD_TTT_BookGen.cpp for the format
+extern const uint16_t TTT_bookSize;
+extern const uint16_t TTT_bookKey[] PROGMEM;
+extern const uint16_t TTT_bookMoves[] PROGMEM;
+
+#define BOOK_STONES   2 ///< opening boards in the book have this many cells occupied or less
+#define BOOK_EMPTY    4 ///< endgame boards in the book have this many cells empty or less
+
+// Powers of 3 for the base-3 board key
+static const uint16_t TTT_pow3[TTT_BOARD_SIZE] PROGMEM = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561 };
+#endif
 
 MD_TTT::MD_TTT(void	(*mh)(uint8_t pos, int8_t player)):
-  _cbMoveHandler(mh), _autoPlayer(TTT_P0)
+  _autoPlayer(TTT_P0), _autoEngine(TTT_ENGINE_HEURISTIC), _autoMode(TTT_MODE_NONE), 
+  _searchNodes(0), _random(0), _cbMoveHandler(mh)
 {
+#if TTT_USE_UNDO
+  _startRandom = 0;
+#endif
+#if TTT_USE_HASH
+  _ttTable = NULL;
+  _ttMask = 0;
+  _ttProbes = _ttHits = 0;
+#endif
+#if TTT_USE_EVENTS
+  _evtQueue = NULL;
+  _evtMask = 0;
+  _evtHead = 0;
+  _evtTail = 0;
+  _evtLost = _evtSeen = 0;
+  _evtLast = 0xff;
+#endif
+  _boardP1 = _boardP2 = 0;
+  _dirty = TTT_BOARD_MASK;
+  _generation = 0;
+#if TTT_USE_STATS
+  resetStats();
+#endif
+#if TTT_USE_STEP
+  _stepState = STEP_IDLE;
+#endif
 }
 
 MD_TTT::~MD_TTT(void)
@@ -63,70 +117,389 @@ MD_TTT::~MD_TTT(void)
 int8_t MD_TTT::getBoardPosition(uint8_t pos)
 {
   if (pos < TTT_BOARD_SIZE)
-    return(_board[pos]);
+  {
+    if (_boardP1 & CELL_MASK(pos)) return(TTT_P1);
+    if (_boardP2 & CELL_MASK(pos)) return(TTT_P2);
+    return(TTT_P0);
+  }
 
   DEBUG("\ngetBoardPosition out of bounds: ", pos);
 
   return(TTT_P0);
 }
 
-bool MD_TTT::setAutoPlayer(int8_t p)
-// set the automatic player to the player id
+bool MD_TTT::setAutoPlayer(int8_t p, uint8_t engine)
+// set the automatic player to the player id and the engine it uses
 {
-  if ((p == TTT_P0) || (p == TTT_P1) || (p == TTT_P2))
+  if ((p != TTT_P0) && (p != TTT_P1) && (p != TTT_P2))
+    return(false);
+
+  switch (engine)
   {
-    DEBUG("\nsetAutoPlayer ", p);
-    _autoPlayer = p;
-    return(true);
+  case TTT_ENGINE_HEURISTIC:
+  case TTT_ENGINE_SEARCH:
+#if TTT_USE_TABLE
+  case TTT_ENGINE_TABLE:
+#endif
+    break;
+
+  default:
+    return(false);
   }
 
-  return(false);
+  DEBUG("\nsetAutoPlayer ", p);
+  DEBUG(" engine ", engine);
+  _autoPlayer = p;
+  _autoEngine = engine;
+
+  return(true);
+}
+
+#if TTT_USE_TABLE
+uint8_t MD_TTT::tableEntry(int8_t player)
+// Look up the board in the perfect play table. The key is the base-3 
+// number with a digit for each cell, 1 for player and 2 for the opponent.
+{
+  uint16_t own = (player == TTT_P1 ? _boardP1 : _boardP2);
+  uint16_t opp = (player == TTT_P1 ? _boardP2 : _boardP1);
+  uint16_t key = 0;
+
+  for (int8_t i=TTT_BOARD_SIZE-1; i>=0; i--)
+  {
+    key *= 3;
+    if (own & CELL_MASK(i)) key += 1;
+    else if (opp & CELL_MASK(i)) key += 2;
+  }
+
+  return(pgm_read_byte(&TTT_perfectTable[key]));
+}
+
+int8_t MD_TTT::getGameValue(int8_t player)
+// Game value for player to move next from the perfect play table
+{
+  uint8_t e = tableEntry(player);
+
+  if (e == TABLE_INVALID)
+  {
+    DEBUG("\ngetGameValue invalid board for P", player);
+    return(TTT_VAL_DRAW);
+  }
+
+  return(TABLE_VALUE(e));
+}
+#endif
+
+#if TTT_USE_BOOK
+uint16_t MD_TTT::bookMoves(int8_t player)
+// Look up the board in the opening book. The book is keyed by the 
+// smallest base-3 key of the board symmetries, so the best moves found 
+// are mapped back from that symmetry onto the board. Returns a bitboard 
+// of the best moves, or 0 if the board is not in the book.
+{
+  uint16_t own = (player == TTT_P1 ? _boardP1 : _boardP2);
+  uint16_t opp = (player == TTT_P1 ? _boardP2 : _boardP1);
+  uint8_t  n = countBits(own | opp);
+  uint16_t key = 0xffff, moves = 0;
+  uint8_t  s = 0;
+  int16_t  lo = 0, hi = TTT_bookSize - 1;
+
+  if (n > BOOK_STONES && n < TTT_BOARD_SIZE - BOOK_EMPTY)
+    return(0);
+
+  for (uint8_t t=0; t<TTT_SYMMETRIES; t++)
+  {
+    uint16_t k = 0;
+
+    for (uint16_t b = own | opp; b != 0; b &= b - 1)
+    {
+      uint8_t i = lowestBit(b);
+      uint16_t p = pgm_read_word(&TTT_pow3[pgm_read_byte(&TTT_sym[t][i])]);
+
+      k += (own & CELL_MASK(i)) ? p : 2 * p;
+    }
+    if (k < key)
+    {
+      key = k;
+      s = t;
+    }
+  }
+
+  // binary search of the sorted keys
+  while (lo <= hi)
+  {
+    int16_t mid = (lo + hi) / 2;
+    uint16_t k = pgm_read_word(&TTT_bookKey[mid]);
+
+    if (k == key)
+    {
+      uint16_t m = pgm_read_word(&TTT_bookMoves[mid]);
+
+      for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+        if (m & CELL_MASK(pgm_read_byte(&TTT_sym[s][i])))
+          moves |= CELL_MASK(i);
+      break;
+    }
+    if (k < key) lo = mid + 1;
+    else hi = mid - 1;
+  }
+
+  return(moves & ~(own | opp));
+}
+#endif
+
+void MD_TTT::setSeed(uint32_t seed)
+{
+  setRandomState(scrambleSeed(seed));
+}
+
+uint32_t MD_TTT::scrambleSeed(uint32_t seed)
+// Scramble the seed so that similar seeds give unrelated sequences
+{
+  seed = (seed ^ (seed >> 16)) * 0x45d9f3bUL;
+  seed = (seed ^ (seed >> 16)) * 0x45d9f3bUL;
+  seed ^= (seed >> 16);
+
+  return(seed == 0 ? RANDOM_DEFAULT : seed);
 }
 
-void MD_TTT::unpackByte(uint8_t *pb, uint8_t b)
-// unpack the byte into the array. MSB is in pb[0]
+void MD_TTT::setRandomState(uint32_t state)
+// Zero is not a valid state for the generator
 {
-  uint8_t	mask = 0x80;
+  _random = (state == 0 ? RANDOM_DEFAULT : state);
+}
 
-  for (uint8_t i=0; i<8; i++, mask>>=1)
-    *pb++ = ((b & mask) ? 1 : 0);
+#if TTT_USE_STATS
+void MD_TTT::getStats(tttStats *pStats)
+{
+  if (pStats != NULL)
+    *pStats = _stats;
 }
 
-bool MD_TTT::randomChoice(void)
-// if millis is odd, then return true, else false
+void MD_TTT::resetStats(void)
 {
+  memset(&_stats, 0, sizeof(_stats));
+}
+#endif
+
+uint8_t MD_TTT::randomChoice(uint32_t *pRandom, uint8_t n)
+// Return a random number [0..n-1] using the xorshift32 generator in 
+// *pRandom. If the generator has not been seeded, seed it from the 
+// time so that games are not repeatable.
+{
+  uint32_t x = *pRandom;
+  uint16_t r, limit;
+
   DEBUGS("R");
-  return((micros() & 0x7) > 3);
+  if (x == 0)
+    x = micros() | 1;
+
+  // discard the values that would make some results more likely
+  limit = (uint16_t)(0x10000UL - (0x10000UL % n));
+  do
+  {
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    r = (uint16_t)(x >> 16);
+  } while (limit != 0 && r >= limit);
+
+  *pRandom = x;
+
+  return(r % n);
 }
 
 bool MD_TTT::start(void)
 {
   DEBUGS("\nStarting NEW GAME");
   // reset the player positions on the board
-  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
-  {
-    _board[i] = TTT_P0;
-    // run the callback to sync the user board
-    if (_cbMoveHandler != NULL)
-      (_cbMoveHandler)(i, TTT_P0);
-  }
+  _dirty |= _boardP1 | _boardP2;
+  _generation++;
+  _boardP1 = _boardP2 = 0;
+
+  // sync the user board
+  notifyClear();
 
   // reset the current game position to start
-  for (uint8_t i=0; i<ARRAY_SIZE(currState); i++)
-    currState[i] = 0;
+  for (uint8_t i=0; i<ARRAY_SIZE(_currState); i++)
+    _currState[i] = 0;
+#if TTT_USE_HASH
+  for (uint8_t i=0; i<ARRAY_SIZE(_hash); i++)
+    _hash[i] = 0;
+#endif
+#if TTT_USE_SCORES
+  for (uint8_t k=0; k<TTT_BOARD_SIZE; k++)
+  {
+    // all lines are at 0, and a move adds 1 to the lines through the cell
+    uint8_t n = countBits(pgm_read_byte(&TTT_wwm[k]));
+
+    for (uint8_t i=0; i<ARRAY_SIZE(_scores[0][0]); i++)
+      _scores[0][k][i] = _scores[1][k][i] = 0;
+    _scores[0][k][3] = _scores[1][k][3] = TTT_WIN_LINES - n;
+    _scores[0][k][4] = _scores[1][k][4] = n;
+  }
+#endif
 
   // game control variables
   _gameOver = false;
   _gameWinner = TTT_P0;
   _movesLeft = TTT_BOARD_SIZE;
   _winLine = 0xff;
+#if TTT_USE_UNDO
+  _moveTop = 0;
+#endif
+  _autoMode = TTT_MODE_NONE;
+
+  // An unseeded generator is seeded now rather than at the first random 
+  // choice, so that the move log has the seed the game was played with.
+  if (_random == 0)
+    _random = micros() | 1;
+#if TTT_USE_UNDO
+  _startRandom = _random;
+#endif
 
   return(true);
 }
 
-bool MD_TTT::doMove(uint8_t pos, int8_t player)
+#if TTT_USE_HASH
+uint32_t MD_TTT::getBoardHash(void)
+// The canonical hash is the smallest of the hashes for all the symmetries
+{
+  uint32_t h = _hash[0];
+
+  for (uint8_t i=1; i<ARRAY_SIZE(_hash); i++)
+    if (_hash[i] < h)
+      h = _hash[i];
+
+  return(h);
+}
+
+void MD_TTT::updateHash(uint8_t pos, int8_t player)
+// Toggle the player in the cell for the hash of each board symmetry
+{
+  const uint32_t *z = TTT_zobrist[player == TTT_P1 ? 0 : 1];
+
+  for (uint8_t i=0; i<ARRAY_SIZE(_hash); i++)
+    _hash[i] ^= pgm_read_dword(&z[pgm_read_byte(&TTT_sym[i][pos])]);
+}
+#else
+uint32_t MD_TTT::getBoardHash(void)
+// Work out the hash of each board symmetry from the bitboards, the 
+// same values that updateHash() keeps, and return the smallest.
+{
+  uint32_t h = 0xffffffff;
+
+  for (uint8_t i=0; i<TTT_SYMMETRIES; i++)
+  {
+    uint32_t s = 0;
+
+    for (uint8_t k=0; k<TTT_BOARD_SIZE; k++)
+    {
+      if (_boardP1 & CELL_MASK(k))
+        s ^= pgm_read_dword(&TTT_zobrist[0][pgm_read_byte(&TTT_sym[i][k])]);
+      else if (_boardP2 & CELL_MASK(k))
+        s ^= pgm_read_dword(&TTT_zobrist[1][pgm_read_byte(&TTT_sym[i][k])]);
+    }
+    if (s < h)
+      h = s;
+  }
+
+  return(h);
+}
+#endif
+
+uint8_t MD_TTT::makeMove(uint8_t pos, int8_t player)
+// Put the player in the cell and update the game matrix, without any 
+// checks or callbacks. Returns the line won by this move or 0xff.
+{
+  uint8_t line = 0xff;
+  uint8_t lines = pgm_read_byte(&TTT_wwm[pos]);
+  uint16_t *pBoard = (player == TTT_P1 ? &_boardP1 : &_boardP2);
+
+  _movesLeft--;
+  *pBoard |= CELL_MASK(pos);
+#if TTT_USE_HASH
+  updateHash(pos, player);
+#endif
+
+  // Only the lines through this cell change, and a line is won 
+  // when all its cells are occupied by this player
+  for (uint8_t i=0, mask=0x80; i<ARRAY_SIZE(_currState); i++, mask>>=1)
+  {
+    if (lines & mask)
+    {
+      uint16_t cells = pgm_read_word(&TTT_wlm[i]);
+
+      _currState[i] += player;
+      if ((*pBoard & cells) == cells)
+        line = i;
+    }
+  }
+
+  return(line);
+}
+
+void MD_TTT::unmakeMove(uint8_t pos, int8_t player)
+// Reverse makeMove() for the same cell and player
+{
+  uint8_t lines = pgm_read_byte(&TTT_wwm[pos]);
+
+  _movesLeft++;
+#if TTT_USE_HASH
+  updateHash(pos, player);
+#endif
+  if (player == TTT_P1)
+    _boardP1 &= ~CELL_MASK(pos);
+  else
+    _boardP2 &= ~CELL_MASK(pos);
+
+  for (uint8_t i=0, mask=0x80; i<ARRAY_SIZE(_currState); i++, mask>>=1)
+    if (lines & mask)
+      _currState[i] -= player;
+}
+
+void MD_TTT::pushMove(uint8_t pos, int8_t player)
+// Make the move, record it on the move stack and update the game status
+{
+#if TTT_USE_UNDO
+  uint8_t *pEntry = &_moveStack[TTT_BOARD_SIZE - _movesLeft];
+#endif
+  uint8_t line = makeMove(pos, player);
+
+  _dirty |= CELL_MASK(pos);
+  _generation++;
+
+#if TTT_USE_SCORES
+  STATS(statsTime_t t0 = STATS_TIME());
+  updateScores(pos, player, ~(_boardP1 | _boardP2) & TTT_BOARD_MASK);
+  STATS(_stats.timeScore += STATS_NS(t0));
+#endif
+
+#if TTT_USE_UNDO
+  *pEntry = pos | (player == TTT_P2 ? MOVE_P2 : 0);
+#endif
+  if (line != 0xff)
+  {
+#if TTT_USE_UNDO
+    *pEntry |= MOVE_WIN;
+#endif
+    _gameOver = true;
+    _gameWinner = player;
+    _winLine = line;
+  }
+#if DEBUG_TTT
+  DEBUGS("\nCur GM");
+  for (uint8_t i=0; i<ARRAY_SIZE(_currState); i++)
+    DEBUG(" ", _currState[i]);
+#endif
+
+  // if there are no moves left to play then the game is also over
+  _gameOver |= (_movesLeft == 0);
+}
+
+bool MD_TTT::doMove(uint8_t pos, int8_t player, bool silent)
 {
-  uint8_t weight[ARRAY_SIZE(currState)];
+  if ((player != TTT_P1) && (player != TTT_P2))
+    return(false);
 
   // first check if we are supposed to make a move
   if (player == _autoPlayer)
@@ -137,199 +510,407 @@ bool MD_TTT::doMove(uint8_t pos, int8_t player)
 
   // now proceed with a normal move
   if (pos >= TTT_BOARD_SIZE) return(false);
-  if (_board[pos] != TTT_P0) return(false);
+  if ((_boardP1 | _boardP2) & CELL_MASK(pos)) return(false);
 
-  // execute the move ...
-  _movesLeft--;
-  _board[pos] = player;
+  // execute the move, which replaces any moves that could be redone ...
+  pushMove(pos, player);
+#if TTT_USE_UNDO
+  _moveTop = TTT_BOARD_SIZE - _movesLeft;
+#endif
 
-  // ... work out what this means to the current game ...
-  DEBUGS("\nCur GM");
-  unpackByte(weight, wwm[pos]);
-  for (uint8_t i=0; i<ARRAY_SIZE(weight); i++)
+  // ... and run the callback
+  if (!silent)
   {
-    currState[i] += (player * weight[i]);
-    DEBUG(" ", currState[i]);
+    notifyCell(pos, player);
+    notifyOver();
+  }
 
-    // check if we have a winner
-    if ((currState[i] == 3) || (currState[i] == -3))
+  return(true);
+}
+
+#if TTT_USE_UNDO
+bool MD_TTT::undoMove(bool silent)
+// Take back the last move using the move stack
+{
+  uint8_t n = TTT_BOARD_SIZE - _movesLeft;
+
+  if (n == 0) return(false);
+
+  uint8_t e = _moveStack[n-1];
+  uint8_t pos = e & MOVE_CELL;
+  bool wasOver = _gameOver;
+
+  DEBUG("\nUndo ", CELL_ID(pos));
+  unmakeMove(pos, (e & MOVE_P2) ? TTT_P2 : TTT_P1);
+  _dirty |= CELL_MASK(pos);
+  _generation++;
+
+#if TTT_USE_SCORES
+  // the scores for the cell were not kept while it was occupied
+  updateScores(pos, (e & MOVE_P2) ? TTT_P1 : TTT_P2, ~(_boardP1 | _boardP2 | CELL_MASK(pos)) & TTT_BOARD_MASK);
+  scoreCell(pos);
+#endif
+
+  // If this move won the game it is no longer won. Play may have 
+  // carried on after an earlier win, so check for that.
+  if (e & MOVE_WIN)
+  {
+    _gameWinner = TTT_P0;
+    _winLine = 0xff;
+    for (uint8_t i=0; i<TTT_WIN_LINES; i++)
     {
-      _gameOver = true;
-      _gameWinner = player;
-      _winLine = i;
+      uint16_t cells = pgm_read_word(&TTT_wlm[i]);
+
+      if ((_boardP1 & cells) == cells) { _gameWinner = TTT_P1; _winLine = i; }
+      if ((_boardP2 & cells) == cells) { _gameWinner = TTT_P2; _winLine = i; }
     }
   }
+  _gameOver = (_winLine != 0xff);
 
-  // ... if there are no moves left to play then the game is also over ...
-  _gameOver |= (_movesLeft == 0);
+  // a queue is told the game is in play again, or the earlier win
+  if (!silent)
+  {
+    notifyCell(pos, TTT_P0);
+    if (wasOver && !_gameOver)
+      notifyResume();
+    else if (e & MOVE_WIN)
+      notifyOver();
+  }
 
-  // ... and run the callback
-  if (_cbMoveHandler != NULL)
-    (_cbMoveHandler)(pos, player);
+  return(true);
+}
+
+bool MD_TTT::redoMove(bool silent)
+// Make the next move on the move stack again
+{
+  uint8_t n = TTT_BOARD_SIZE - _movesLeft;
+
+  if (n >= _moveTop) return(false);
+
+  uint8_t e = _moveStack[n];
+  uint8_t pos = e & MOVE_CELL;
+  int8_t player = (e & MOVE_P2) ? TTT_P2 : TTT_P1;
+
+  DEBUG("\nRedo ", CELL_ID(pos));
+  pushMove(pos, player);
+
+  if (!silent)
+  {
+    notifyCell(pos, player);
+    notifyOver();
+  }
 
   return(true);
 }
+#endif
+
+#if TTT_USE_SCORES
+void MD_TTT::scoreCell(uint8_t k)
+// Work out the standardized scores histograms for a move into cell k by 
+// either player from the game matrix. Index 0 of _scores is for TTT_P1 
+// and 1 for TTT_P2. A line at value v after the move is counted at 
+// [3 + v] for TTT_P1 and [3 - v] for TTT_P2, so the preferred scores 
+// are always the higher indices.
+{
+  uint8_t lines = pgm_read_byte(&TTT_wwm[k]);
+
+  for (uint8_t i=0; i<ARRAY_SIZE(_scores[0][0]); i++)
+    _scores[0][k][i] = _scores[1][k][i] = 0;
+
+  for (uint8_t i=0, mask=0x80; i<TTT_WIN_LINES; i++, mask>>=1)
+  {
+    int8_t on = (lines & mask) ? 1 : 0;
+
+    _scores[0][k][3 + (_currState[i] + on)]++;
+    _scores[1][k][3 - (_currState[i] - on)]++;
+  }
+}
+
+void MD_TTT::updateScores(uint8_t pos, int8_t delta, uint16_t cells)
+// The lines through pos have just changed by delta. Move the count for 
+// each of these lines to its new value in the histograms of the cells.
+// A move into a cell on the line adds one more to the line value.
+{
+  uint8_t lines = pgm_read_byte(&TTT_wwm[pos]);
+
+  for (uint8_t i=0, mask=0x80; i<TTT_WIN_LINES; i++, mask>>=1)
+  {
+    if (!(lines & mask))
+      continue;
+
+    int8_t to = _currState[i];
+    int8_t from = to - delta;
+    uint16_t line = pgm_read_word(&TTT_wlm[i]);
+
+    for (uint16_t b = cells; b != 0; b &= b - 1)
+    {
+      uint8_t k = lowestBit(b);
+      uint8_t *s1 = _scores[0][k];
+      uint8_t *s2 = _scores[1][k];
+      int8_t on = (line >> k) & 1;
+
+      s1[3 + from + on]--;
+      s1[3 + to + on]++;
+      s2[3 - from + on]--;
+      s2[3 - to + on]++;
+    }
+  }
+}
+#else
+void MD_TTT::boardScores(uint8_t scores[][7], int8_t player)
+// Work out the standardized scores histograms for a move by player into 
+// each empty cell, the same values that updateScores() keeps.
+{
+  uint16_t empty = ~(_boardP1 | _boardP2) & TTT_BOARD_MASK;
+
+  uint8_t sets[7];
+
+  STATS(statsTime_t t0 = STATS_TIME());
+  lineSets(sets, _currState, player);
+  scoreMoves(scores, sets, empty);
+  STATS(_stats.timeScore += STATS_NS(t0));
+}
+#endif
 
 uint8_t MD_TTT::doAutoMove(int8_t player)
 // Determine and select the best available move
 {
-  uint8_t p = 0xff; // best move position to be returned
-  uint8_t scores[TTT_BOARD_SIZE][7];  // indices should be [-3, -2, -1, 0, 1, 2, 3] - need to offset by 3 for zero based array
-  uint8_t tryMode;  // modes for move selection
+  uint16_t empty = ~(_boardP1 | _boardP2) & TTT_BOARD_MASK; // bitboard of the potential moves
+  uint8_t p, ties;
+
+#if TTT_USE_STEP
+  // use the move worked out by stepAutoMove() if it is for this board
+  if (isMoveReady() && _stepPlayer == player)
+  {
+    _stepState = STEP_IDLE;
+    return(_stepMove);
+  }
+#endif
 
   DEBUG("\nAutomove P", player);
+  STATS(_stats.calls++);
 
-  // reset the scores matrix
-  for (uint8_t k=0; k<TTT_BOARD_SIZE; k++)
-    for (uint8_t i=0; i<ARRAY_SIZE(scores[0]); i++)
-      scores[k][i] = 0;
+  if (_autoEngine == TTT_ENGINE_SEARCH)
+  {
+    _autoMode = TTT_MODE_SEARCH;
+    STATS(_stats.modeHits[_autoMode]++);
+    return(searchMove(player));
+  }
 
-  // work out the scores array for each position
-  for (uint8_t k=0; k<TTT_BOARD_SIZE; k++)
+#if TTT_USE_TABLE
+  if (_autoEngine == TTT_ENGINE_TABLE)
   {
-    uint8_t		weight[ARRAY_SIZE(currState)];	// for unpacking the weighting
+    uint8_t e = tableEntry(player);
 
-    if (_board[k] == TTT_P0)	// an empty cell so a potential move
+    // if the board is not in the table fall through to the heuristic
+    if (e != TABLE_INVALID && TABLE_MOVE(e) < TTT_BOARD_SIZE)
     {
-      unpackByte(weight, wwm[k]);
-
-      DEBUG("\n", CELL_ID(k));
-      for (uint8_t i=0; i<ARRAY_SIZE(weight); i++)
-      {
-        int8_t	s;
-
-        s = currState[i] + (player * weight[i]);
-        DEBUG(" ", s);
-        scores[k][s+3]++;	// one more for this team (offset)
-      }
-
-      // debug print the scores for this line
-      DEBUGS("\tS:");
-      for (uint8_t i=0; i<ARRAY_SIZE(scores[0]); i++)
-        DEBUG(" ", scores[k][i]);
+      DEBUG("\nTable move at cell ", CELL_ID(TABLE_MOVE(e)));
+      _autoMode = TTT_MODE_TABLE;
+      STATS(_stats.modeHits[_autoMode]++);
+      return(TABLE_MOVE(e));
     }
   }
+#endif
 
-  // player sign determines our preferred score being + or -, 
-  // so to standardiZe how we check the score we swap the location 
-  // of the scores based on which player this is.
-  if (player < 0) // preferred scOres are -ve
+#if TTT_USE_BOOK
   {
-    for (uint8_t k=0; k<TTT_BOARD_SIZE; k++)
+    uint16_t book = bookMoves(player);
+
+    // pick one of the equally good book moves at random
+    if (book != 0)
     {
-#define SWAP(i, j) \
-      { \
-        int8_t t = scores[k][i]; \
-        scores[k][i] = scores[k][j]; \
-        scores[k][j] = t; \
-      }
-      SWAP(0, 6);
-      SWAP(1, 5);
-      SWAP(2, 4);
-#undef SWAP
+      for (uint8_t n = randomChoice(&_random, countBits(book)); n > 0; n--)
+        book &= book - 1;
+      p = lowestBit(book);
+      DEBUG("\nBook move at cell ", CELL_ID(p));
+      _autoMode = TTT_MODE_BOOK;
+      STATS(_stats.modeHits[_autoMode]++);
+      return(p);
     }
-    DEBUGS("\nSWAPPED score matrix");
   }
+#endif
 
-  // now do our checks on the scores array to get the best move
-  // Scores array indices [0..7] are for scores [-3, -2, -1, 0, 1, 2, 3], so given any score,
-  // its index position is offset by +3 eg, score -2 is position 1 in the array (-2 + 3 = 1)
-  tryMode = 0;        // the criterion to use for checking optimal move (switch statement)
-  while (p == 0xff)   // when we have a return value, stop looking
+#if TTT_USE_SCORES
+  uint8_t (*scores)[7] = _scores[player == TTT_P1 ? 0 : 1];
+
+  STATS(statsTime_t t0 = STATS_TIME());
+  p = selectMove(scores, empty, &_random, &_autoMode, &ties);
+#else
+  uint8_t sets[7];
+
+  STATS(statsTime_t t0 = STATS_TIME());
+  lineSets(sets, _currState, player);
+  STATS(_stats.timeScore += STATS_NS(t0));
+  STATS(t0 = STATS_TIME());
+  p = selectMove(sets, empty, &_random, &_autoMode, &ties);
+#endif
+  STATS(_stats.timeSelect += STATS_NS(t0));
+  STATS(_stats.tieBreaks += (ties > 1));
+  STATS(_stats.modeHits[_autoMode]++);
+
+  return(p);
+}
+
+void MD_TTT::lineSets(uint8_t sets[7], const int8_t *state, int8_t player)
+// Work out the set of win lines with each line score [-3..3], standardized 
+// so that player's preferred scores are always +ve. Line i is bit 0x80>>i, 
+// the same as in TTT_wwm, so the lines through a cell are a mask away.
+{
+  for (uint8_t j=0; j<7; j++)
+    sets[j] = 0;
+
+  for (uint8_t i=0, mask=0x80; i<TTT_WIN_LINES; i++, mask>>=1)
+    sets[3 + (player < 0 ? -state[i] : state[i])] |= mask;
+}
+
+void MD_TTT::scoreMoves(uint8_t scores[][7], const uint8_t sets[7], uint16_t empty)
+// Work out the standardized scores array for each potential move in empty
+// from the line sets. Moving into a cell adds one to each line through the
+// cell, so a line scoring j after the move is either a line through the 
+// cell that scored j-1 or a line not through it that scored j.
+{
+  for (uint16_t b = empty; b != 0; b &= b - 1)
   {
-    uint8_t	curBest = 0xff; // save current best move for comparison to others
+    uint8_t k = lowestBit(b);
+    uint8_t lines = pgm_read_byte(&TTT_wwm[k]);
+
+    scores[k][0] = countLines(sets[0] & ~lines);
+    for (uint8_t j=1; j<7; j++)
+      scores[k][j] = countLines((sets[j] & ~lines) | (sets[j-1] & lines));
+
+    // debug print the scores for this cell
+    DEBUG("\n", CELL_ID(k));
+    DEBUGS("\tS:");
+    for (uint8_t i=0; i<ARRAY_SIZE(scores[0]); i++)
+      DEBUG(" ", scores[k][i]);
+  }
+}
+
+uint16_t MD_TTT::moveKey(const uint8_t s[7], uint8_t k)
+// The sort key for a move into cell k with the standardized scores s, 
+// larger is better. The high bits are the first mode that selects the 
+// cell, the low bits the criteria used to choose between cells within 
+// that mode: the most 2's (or 1's), then the fewest opponent 1's.
+{
+  uint8_t mode, more, fewer;
+
+  if (s[6] != 0)                                    mode = TTT_MODE_WIN;
+  else if (s[5] != 0 && s[1] == 0 && s[2] == 0)     mode = TTT_MODE_2_CLEAR;
+  else if (s[5] != 0 && s[1] == 0)                  mode = TTT_MODE_2_SAFE;
+  else if (s[4] != 0 && s[1] == 0)                  mode = TTT_MODE_1_SAFE;
+  else if (s[4] != 0)                               mode = TTT_MODE_1;
+  else                                              mode = TTT_MODE_FIRST;
+
+  switch (mode)
+  {
+  case TTT_MODE_WIN:   more = 0; fewer = 0xf - k;         break;  // highest cell
+  case TTT_MODE_FIRST: more = 0; fewer = k;               break;  // lowest cell
+  case TTT_MODE_2_CLEAR:
+  case TTT_MODE_2_SAFE: more = s[5]; fewer = s[2];        break;  // most 2's, fewest opponent 1's
+  default:             more = s[4]; fewer = s[2];         break;  // most 1's, fewest opponent 1's
+  }
+
+  return(((uint16_t)(TTT_MODE_FIRST - mode) << 8) | (more << 4) | (0xf - fewer));
+}
 
-    DEBUG("\nTrying Mode ", tryMode);
-    for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+uint16_t MD_TTT::lineKey(const uint8_t sets[7], uint8_t k)
+// The moveKey() for cell k worked out directly from the line sets, 
+// counting only the scores the key needs.
+{
+  uint8_t lines = pgm_read_byte(&TTT_wwm[k]);
+  uint8_t s[7];
+
+  s[0] = s[3] = 0;
+  for (uint8_t j=1; j<7; j++)
+    if (j != 3)
+      s[j] = countLines((sets[j] & ~lines) | (sets[j-1] & lines));
+
+  return(moveKey(s, k));
+}
+
+uint8_t MD_TTT::selectMove(uint8_t scores[][7], uint16_t empty, uint32_t *pRandom, uint8_t *pMode, uint8_t *pTies)
+// Select the best move from the standardized scores array.
+{
+  uint16_t key[TTT_BOARD_SIZE];
+
+  for (uint16_t b = empty; b != 0; b &= b - 1)
+  {
+    uint8_t k = lowestBit(b);
+
+    key[k] = moveKey(scores[k], k);
+  }
+
+  return(selectKey(key, empty, pRandom, pMode, pTies));
+}
+
+uint8_t MD_TTT::selectMove(const uint8_t sets[7], uint16_t empty, uint32_t *pRandom, uint8_t *pMode, uint8_t *pTies)
+// Select the best move from the line sets, without building the scores
+// arrays.
+{
+  uint16_t key[TTT_BOARD_SIZE];
+
+  for (uint16_t b = empty; b != 0; b &= b - 1)
+  {
+    uint8_t k = lowestBit(b);
+
+    key[k] = lineKey(sets, k);
+  }
+
+  return(selectKey(key, empty, pRandom, pMode, pTies));
+}
+
+uint8_t MD_TTT::selectKey(const uint16_t *key, uint16_t empty, uint32_t *pRandom, uint8_t *pMode, uint8_t *pTies)
+// Select the move with the largest moveKey(). Ties are broken randomly 
+// using the generator in pRandom, with every tied cell equally likely to 
+// be chosen. If pRandom is NULL the lowest numbered cell is kept.
+// If pMode is not NULL it is set to the mode (TTT_MODE_*) that selected 
+// the move, and if pTies is not NULL to the number of cells tied for it.
+//
+// The cells of the best mode are taken in cell order, a tied cell 
+// replacing the current best with probability 1/ties. This uses the 
+// random generator exactly as the original one pass per mode did, so 
+// the same seed still plays the same game.
+{
+  uint16_t best = 0;
+  uint8_t  p = 0xff;
+  uint8_t  ties = 0;
+
+  if (empty == 0)
+    return(0xff);
+
+  for (uint16_t b = empty; b != 0; b &= b - 1)
+  {
+    uint16_t v = key[lowestBit(b)];
+
+    if (v > best) best = v;
+  }
+
+  for (uint16_t b = empty; b != 0; b &= b - 1)
+  {
+    uint8_t  k = lowestBit(b);
+    uint16_t v = key[k];
+
+    if ((v >> 8) != (best >> 8))
+      continue;
+
+    if (p == 0xff || v > key[p])
     {
-      if (_board[i] == TTT_P0)
-      {
-        DEBUG(": ", CELL_ID(i));
-        switch (tryMode)
-        {
-        case 0:
-          // best move if we have any 3 scores as we have the winning move
-          if (scores[i][6] != 0)
-            curBest = i;
-          break;
-
-        case 1:
-          // next best is highest number of 2 provided there are no 2 or 1 of opposite sign, 
-          // as it means other player would win the match
-          if ((scores[i][5] != 0) && (scores[i][1] == 0) && (scores[i][2] == 0))
-          {
-            if ((curBest == 0xff) || (scores[i][5] > scores[curBest][5]))
-              curBest = i;
-            else if (scores[i][5] == scores[curBest][5])
-              curBest = (randomChoice() ? i : curBest);
-          }
-          break;
-
-        case 2:
-          // next best is highest number of 2 provided there are no 2 of opposite sign, 
-          // as it means other player would win the match
-          if ((scores[i][5] != 0) && (scores[i][1] == 0))
-          {
-            if ((curBest == 0xff) || (scores[i][5] > scores[curBest][5]))
-              curBest = i;
-            else if (scores[i][5] == scores[curBest][5])
-            {
-              if (scores[i][2] < scores[curBest][2])  // advantage of fewer 1's
-                curBest = i;
-              else if (scores[i][2] == scores[curBest][2]) // same number of 1's
-                curBest = (randomChoice() ? i : curBest);
-            }
-          }
-          break;
-
-        case 3:
-          // next best is highest number of 1 provided there are no 2 of opposite sign, 
-          // as it means other player would win the match
-          if ((scores[i][4] != 0) && (scores[i][1] == 0))
-          {
-            if ((curBest == 0xff) || (scores[i][4] > scores[curBest][4]))
-              curBest  = i;
-            else if (scores[i][4] == scores[curBest][4]) 
-            {
-              if (scores[i][2] < scores[curBest][2])  // lowest opponent 1's
-                curBest = i;
-              else if (scores[i][2] == scores[curBest][2]) // same number of 1's
-                curBest = (randomChoice() ? i : curBest);
-            }
-          }
-          break;
-
-        default:
-          // next best is highest number of 1 with no other consideration
-          if (scores[i][4] != 0)
-          {
-            if ((curBest == 0xff) || (scores[i][4] > scores[curBest][4]))
-              curBest = i;
-            else if (scores[i][4] == scores[curBest][4])
-            {
-              if (scores[i][2] < scores[curBest][2])	// lowest opponent 1's
-                curBest = i;
-              else if (scores[i][2] == scores[curBest][2]) // same number of 1's
-                curBest = (randomChoice() ? i : curBest);
-            }
-          }
-          break;
-        } // switch
-        DEBUG("/", curBest);
-      } // if
-    } // for
-
-    // have we got a current best move?
-    if (curBest != 0xff)
+      p = k;
+      ties = 1;
+    }
+    else if (v == key[p])
     {
-      p = curBest;
-      DEBUG("\nBest move at cell '", CELL_ID(p));
-      DEBUG("' on mode ", tryMode);
+      ties++;
+      if (pRandom != NULL && randomChoice(pRandom, ties) == 0)
+        p = k;
     }
+  }
 
-    tryMode++;  // try the next best criteria if we go around again
-
-  } // while
+  if (pMode != NULL) *pMode = TTT_MODE_FIRST - (best >> 8);
+  if (pTies != NULL) *pTies = ties;
+  DEBUG("\nBest move at cell '", CELL_ID(p));
+  DEBUG("' on mode ", TTT_MODE_FIRST - (best >> 8));
 
   return(p);
 }
@@ -31,6 +31,56 @@ accessed at http://www.omnimaga.org/math-and-science/tic-tac-toe-algorithm/
 
 Revision History
 ----------------
+October 2026 - version 1.1.0
+- Game state is now held in each MD_TTT object, so independent games can run 
+concurrently. See Thread Safety in \ref pageLibrary.
+- Board held as bitboards, with win detection and move scoring done on 
+line masks. See Bitboards in \ref pageLibrary.
+- Added optional perfect play table, selected as the auto player engine 
+with setAutoPlayer(), and getGameValue().
+- Added evalBoards() to evaluate a batch of boards in one call.
+- Added TTT_ENGINE_SEARCH, a full game tree search engine, and the 
+MD_TTT_Bench example.
+- Added symmetry independent board hash getBoardHash() and an optional 
+transposition table for the search engine.
+- Added MD_TTT_MNK template for larger m,n,k games and the 
+MD_TTT_MNK_Console example.
+- Added undoMove() and redoMove() using a move stack, and a silent option 
+to make and take back moves without invoking the callback.
+- Random choices now use a seedable generator in each MD_TTT object, see 
+setSeed(). All tied moves are now equally likely to be chosen.
+- The library can be built on a host computer without the Arduino core, 
+with a CMake build for the library, unit tests and the 
+tools/MD_TTT_HostBench.cpp benchmark.
+- Added getAutoMode() and the tools/MD_TTT_Tournament.cpp self play 
+tournament program.
+- Added optional auto player instrumentation, see TTT_USE_STATS.
+- The move scores can be updated as each move is made, making the 
+heuristic auto player move faster, see TTT_USE_SCORES. This and the board 
+hashes and move stack, see TTT_USE_HASH and TTT_USE_UNDO, are off by 
+default so an MD_TTT object stays small.
+- Added serialize(), deserialize() and tttStateView to save, restore and 
+transfer games.
+- Added writeLog() and replayLog() for compact move logs.
+- Added an optional opening book and endgame table for the heuristic 
+auto player, see TTT_USE_BOOK.
+- Added analyze() to rank all the legal moves, for hints.
+- Added optional beginAutoMove() and stepAutoMove() to work out the auto 
+player move a time slice at a time, see TTT_USE_STEP.
+- Added MD_TTTPool to hold many games in one block of memory, see Game 
+Pools in \ref pageLibrary.
+- Added MD_TTTPool::doMoves() and MD_TTTPool::setBatchHandler() to make 
+a batch of moves in different games in one call.
+- Added optional setEventQueue() and getEvent() to queue display updates 
+in place of the move callback, see TTT_USE_EVENTS and Event Queue in 
+\ref pageLibrary.
+- Added getDirty(), getGeneration() and clearDirty() so displays redraw 
+only the cells that changed.
+- The game tables are generated by the compiler from the board geometry 
+with constexpr and kept in program memory (PROGMEM).
+- Added the tools/MD_TTT_Enum.cpp position space enumerator and the 
+tools/MD_TTT_Verify.cpp exhaustive check of the heuristic auto player.
+
 April 2018 - version 1.0.1
 - Minor documentation uypdates
 
@@ -194,23 +244,443 @@ move, and 3 means someone wins!
 it means other player would win the match.
 
 If there is more than one ‘best’ move than it is possible to select randomly 
-between choices that fit the highest criterion. This makes the algorithm slightly 
-unpredictable and can result in moves that allow the other player to win the 
-game, thus relieving the boredom of always losing against the computer!
+between choices that fit the highest criterion, each being equally likely. This 
+makes the algorithm slightly unpredictable and can result in moves that allow 
+the other player to win the game, thus relieving the boredom of always losing 
+against the computer!
 
 The game is over when there are any 3’s or -3’s and the column in which this 
 number appears will also tell exactly where to strike through for wins.
+
+Bitboards
+---------
+Internally the board is held as two 9-bit masks (bitboards), one for the cells 
+occupied by each player. Bit 0 is cell _a_ and bit 8 is cell _i_. Each winning 
+line also has a mask of its cells, so a line is won when
+
+    (player bitboard & line mask) == line mask
+
+and the empty cells, the legal moves, are the cells not set in either bitboard. 
+The game matrix [M] is still kept as the basis for the move scoring. 
+
+For the move scoring the lines are split by their value, from the point of 
+view of the player moving, into 7 line sets. Each set is a mask with a bit 
+for each line, and the lines through each cell are a mask of the same form. 
+A move adds 1 to the value of each line through its cell, so the number of 
+lines with value v after a move is the count of the bits set in
+
+    (set[v] & ~cell lines) | (set[v-1] & cell lines)
+
+The heuristic criteria for a cell are folded into one sort key, and the best 
+move is picked from the keys in one pass over the empty cells rather than 
+one pass for each criterion.
+
+The line masks, the lines through each cell and the board symmetries are 
+worked out by the compiler from the board size and are kept in program 
+memory (PROGMEM), so on AVR they take no RAM. 
+
+With TTT_USE_SCORES set to 1 the scores for a move into each cell are kept 
+for both players, and are updated as each move is made rather than being 
+worked out again for each auto player move. A move only changes the values 
+of the lines through its cell, so only the counts for those lines are moved 
+in the scores for each cell. The scores for TTT_P2 are kept reversed (a -3 
+is counted as a 3) so that the preferred scores are in the same place for 
+both players. This makes each heuristic auto player move faster, at the 
+cost of 126 bytes of RAM and a slower doMove().
+
+Perfect Play Table
+------------------
+As an alternative to the algorithm, the auto player can look up its move in 
+a precomputed table of the best move for every board that can occur in a game. 
+The table is indexed by a base-3 key for the board as seen by the player about 
+to move, where cell _i_ adds 3^i times 0 (empty), 1 (own) or 2 (opponent).
+
+Each table entry also holds the game theoretic value of the board (win, draw 
+or loss with perfect play from both players), available through getGameValue().
+
+The table is generated by the program tools/MD_TTT_TableGen.cpp and needs 
+almost 20kB of program memory, so it is only included when TTT_USE_TABLE 
+is set to 1 in MD_TTT.h.
+
+Opening Book and Endgame Table
+------------------------------
+The heuristic auto player can first look up its move in a small book of 
+the boards with at most 2 cells occupied (the opening) or at most 4 cells 
+empty (the endgame). The opening is where the first auto player move has 
+the most cells to score and where the choice of the heuristic matters 
+least, and the endgame is where a heuristic mistake is most likely to 
+lose the game.
+
+Only one of the 8 rotations and reflections of each board is kept, the 
+one with the smallest base-3 key (as for the perfect play table), and 
+the move found is mapped back onto the board being played. Each entry 
+holds all the equally best moves, so the auto player still chooses 
+randomly between them. In the opening the best moves are the ones that 
+leave the opponent the most replies that lose.
+
+The book is generated by the program tools/MD_TTT_BookGen.cpp and takes 
+about 2kB of program memory, so it is only included when TTT_USE_BOOK 
+is set to 1 in MD_TTT.h. Boards outside the book are played by the 
+algorithm as before.
+
+Game Tree Search
+----------------
+The TTT_ENGINE_SEARCH auto player engine searches the whole game tree using 
+negamax with alpha-beta pruning, so it always plays a perfect move. A win is 
+scored higher the earlier it occurs, so the engine wins as quickly as possible 
+and delays a loss as long as possible.
+
+The moves are made and unmade in place on the board and game matrix [M], 
+and at each position the moves are searched in the order suggested by the 
+algorithm scores: winning moves first, then moves that block an opponent's 
+2, then the moves that make the most 2's and 1's. This ordering lets the 
+alpha-beta pruning cut off most of the tree.
+
+Time-Sliced Auto Player Moves
+-----------------------------
+A search engine move can take long enough to hold up a sketch that needs 
+to keep its display and inputs running. When TTT_USE_STEP is set to 1, 
+beginAutoMove() starts working out the auto player move and each call to 
+stepAutoMove() does the work for a time budget and returns. The search 
+is negamax with the recursion replaced by a stack of frames kept in the 
+MD_TTT object, so it can stop between any two boards and carry on from 
+there. It finds the same move as doMove() would. When isMoveReady() is 
+true, doMove() for the auto player makes that move.
+
+On a host computer the same methods can be run as a C++20 coroutine or 
+behind a std::future, as shown in the program tools/MD_TTT_Async.cpp.
+
+Board Hash and Transposition Table
+----------------------------------
+Each board has a 32 bit Zobrist hash, formed by XORing a fixed random key 
+for each occupied cell and player, for each of the 8 rotations and 
+reflections of the board. The smallest of these is the canonical hash for 
+the board, the same for all its symmetries.
+
+The search engine can use this hash to store the boards already searched 
+in a fixed size transposition table, so a board that is reached again 
+(by another sequence of moves or as a symmetry of one already seen) is 
+not searched again. The memory for the table is provided by the calling 
+program with setTransTable().
+
+The hashes and the transposition table are only included when TTT_USE_HASH 
+is set to 1, and the hashes are then updated as each move is made. 
+Otherwise getBoardHash() works the hash out from the board each time.
+
+Larger Boards
+-------------
+The MD_TTT_MNK class template in MD_TTT_MNK.h extends the game to m,n,k 
+games, where the players need K in a row on a board with any number of rows 
+and columns (eg, 4x4 with 4 in a row or 15x15 Gomoku with 5 in a row). The 
+board size is fixed at compile time, so the win lines and the types used to 
+hold the board are all worked out by the compiler for that size. Its auto 
+player uses a depth limited search, as searching the whole game is only 
+practical for small boards. MD_TTT remains the engine for the classic game.
+
+Saving and Restoring Games
+--------------------------
+These need TTT_USE_UNDO set to 1, as the move stack is saved with the game.
+serialize() saves the state of a game in TTT_SERIAL_SIZE (28) bytes, which 
+can be stored or sent to another device and restored there with 
+deserialize(). Multi-byte values are stored LSB first, so the format does 
+not depend on the processor. The bytes are
+
+| Offset | Size | Contents                                             |
+|-------:|-----:|:-----------------------------------------------------|
+|      0 |    1 | format version, TTT_SERIAL_VERSION                   |
+|      1 |    2 | TTT_P1 bitboard (bit i is cell i)                    |
+|      3 |    2 | TTT_P2 bitboard                                      |
+|      5 |    1 | auto player (TTT_P*)                                 |
+|      6 |    1 | auto player engine (TTT_ENGINE_*)                    |
+|      7 |    1 | winning line (TTT_WL_*), 0xff if none                |
+|      8 |    1 | winner (TTT_P*)                                      |
+|      9 |    1 | flags, bit 0 set if the game is over                 |
+|     10 |    4 | random generator state                               |
+|     14 |    4 | random generator state at start(), for writeLog()    |
+|     18 |    1 | number of moves on the move stack, including redo    |
+|     19 |    9 | move stack, bits 0-3 the cell, bit 6 set for TTT_P2, bit 7 set if the move won |
+
+The game matrix [M] and the board hashes are not saved, as they are worked 
+out again from the bitboards. The tttStateView class reads the fields 
+directly from a buffer without restoring the game.
+
+Move Logs
+---------
+A move log is a sequence of game records, each written by writeLog() and 
+appended to the log. writeLog() needs TTT_USE_UNDO set to 1. A record has 
+a TTT_LOG_HEADER byte header followed by the moves, 2 moves in each byte 
+with the first in the low 4 bits. The players take turns, so only the 
+cells are recorded. The header is
+
+| Offset | Size | Contents                                              |
+|-------:|-----:|:------------------------------------------------------|
+|      0 |    1 | bits 0-3 the number of moves, bit 4 set if TTT_P2 moved first, bits 5-7 the format version (0) |
+|      1 |    1 | bits 0-1 the auto player (0 none, 1 TTT_P1, 2 TTT_P2), bits 2-3 the auto player engine |
+|      2 |    4 | random generator state at start(), LSB first          |
+
+A complete game takes at most TTT_LOG_MAX_SIZE (11) bytes. replayLog() 
+checks and replays the games in a log much faster than playing them 
+through doMove().
+
+Event Queue
+-----------
+By default the callback is invoked before doMove() returns, and start() 
+invokes it for each of the 9 cells. Where each update means a slow display 
+transfer (eg, an I2C or SPI LCD) this holds up the game. With 
+setEventQueue() the game instead pushes events into a ring buffer supplied 
+by the sketch, one byte for each event, and the sketch takes them out with 
+getEvent() at its own rate. The event queue is included when 
+TTT_USE_EVENTS is set to 1. The events are
+
+| Type          | pos                     | player                  |
+|:--------------|:------------------------|:------------------------|
+| TTT_EVT_CELL  | the cell that changed   | the player now in it    |
+| TTT_EVT_CLEAR | -                       | -                       |
+| TTT_EVT_OVER  | the winning line, or 0xff | the winner, or TTT_P0 |
+| TTT_EVT_SYNC  | -                       | -                       |
+| TTT_EVT_RESUME | -                      | -                       |
+
+start() queues one TTT_EVT_CLEAR, and further start() calls with nothing 
+in between add nothing, so the display is cleared once. An undoMove() 
+that takes back the move that ended the game queues TTT_EVT_RESUME after 
+the cell, or TTT_EVT_OVER if an earlier win still stands. The queue has a 
+single producer (the game) and a single consumer (getEvent()), which 
+each write only their own index, so they may run in different threads or 
+in an interrupt without a lock. The game never waits: if the queue is 
+full the event is dropped and getEvent() returns TTT_EVT_SYNC, discarding 
+the rest of the queue, so the sketch can draw the whole board again. The 
+program tools/MD_TTT_Events.cpp checks the queue with the game and the 
+display in different threads.
+
+Changed Cells
+-------------
+A display that draws the whole board after every move sends far more than 
+has changed, which is slow over a serial link or a shift register LCD. The 
+library marks each cell that changes in a bitboard returned by getDirty(), 
+and counts the changes in getGeneration(). The display code checks the 
+generation, draws only the dirty cells and calls clearDirty(). start() only 
+marks the cells that were occupied. The MD_TTT_Console example does this 
+on an ANSI terminal, and tools/MD_TTT_Redraw.cpp measures the bytes sent, 
+124 bytes for the whole board against 21 bytes for the cell of a move.
+
+Game Pools
+----------
+An MD_TTT object takes 33 bytes on AVR, and over 200 bytes with all the 
+optional game state switches set to 1. A program that hosts thousands of 
+games at once, such as a game server, can instead keep them in an MD_TTTPool (MD_TTT_Pool.h). The 
+pool divides a block of memory supplied by the program into games of 
+TTT_POOL_GAME_SIZE (9) bytes each, held as a structure of arrays
+
+| Array    | Size | Contents                                               |
+|:---------|-----:|:-------------------------------------------------------|
+| lines    |    4 | game matrix [M], 4 bits for each line, or the next free game |
+| boardP1  |    2 | TTT_P1 bitboard                                        |
+| boardP2  |    2 | TTT_P2 bitboard                                        |
+| status   |    1 | in use, game over, auto player and winning line       |
+
+acquire() returns a handle to a free game and release() gives it back. The 
+free games are linked through the lines array, so neither needs to search 
+the pool. The auto player uses the heuristic engine, working out the move 
+scores from the game matrix when the move is needed. As the arrays are 
+dense, moves spread across many games touch far fewer cache lines than 
+separate objects. tools/MD_TTT_PoolBench.cpp compares the two.
+
+A server that advances all its games each tick can fill an array of 
+tttPoolMove and pass it to doMoves(). The moves, including the auto player 
+moves and the win checks, are made in one loop and the user code is then 
+called once with the whole batch (see setBatchHandler()), rather than 
+once for each move. To spread the games over several threads, give each 
+thread its own pool.
+
+Position Space
+--------------
+The program tools/MD_TTT_Enum.cpp plays out the whole game tree with the 
+library, using doMove() and undoMove(), and counts the boards that can be 
+reached in a game
+
+| Count                        | All boards | Without symmetry |
+|:-----------------------------|-----------:|-----------------:|
+| Boards                       |       5478 |              765 |
+| Boards with the game over    |        958 |              138 |
+
+and the 255,168 complete games: 131,184 won by the first player, 77,904 
+won by the second and 46,080 drawn. For each board it also works out the 
+game value and best moves, and plays the heuristic auto player against a 
+perfect opponent to find the boards where the heuristic does worse than 
+the game value. It checks the counts above, so it can be run as a test, 
+and writes a binary file with one record for each board, laid out as in 
+tools/MD_TTT_Positions.h, that other programs can map into memory.
+
+The heuristic auto player is not a perfect player. tools/MD_TTT_Verify.cpp 
+checks every move it can make from each of the 4520 boards where the game 
+is not over, with either player moving first. Rather than sampling the 
+random tie breaks it finds every cell tied for the best score, and 
+compares each with the game value from its own negamax search. From 98 
+of the boards the heuristic can choose a move that is worse than the game 
+value (16 in TTT_MODE_2_CLEAR, 70 in TTT_MODE_2_SAFE, 12 in 
+TTT_MODE_1_SAFE), and from 50 of them a move that loses the game. It runs 
+in well under a second and exits with an error if these counts change, 
+so it can be run as a test after changes to the heuristic. Use 
+TTT_ENGINE_SEARCH or TTT_ENGINE_TABLE for perfect play.
+
+Host Builds
+-----------
+When ARDUINO is not defined, MD_TTT.h includes MD_TTT_HAL.h in place of 
+Arduino.h. This supplies the few Arduino definitions used by the library 
+(program memory access, micros() and debug output) from the standard 
+library, so the library source files compile unchanged on a host computer. 
+This is useful to test and profile the game engine. The program 
+tools/MD_TTT_HostBench.cpp measures the speed of the library this way.
+
+The CMakeLists.txt in the library folder builds the library (md_ttt), 
+the unit tests in tools/MD_TTT_Test.cpp (md_ttt_test), the benchmark 
+(md_ttt_bench) and the other tools. The library is also built with all 
+the optional game state switched on (md_ttt_full), and the unit tests and 
+benchmark are built with both. ctest runs the unit tests and the tools 
+that check their results, and fails if any of them do
+
+    cmake -S . -B build
+    cmake --build build
+    ctest --test-dir build
+
+Configure with -DTTT_SANITIZE=ON to build everything with the thread 
+sanitizer, so the tests that use threads also check for data races.
+
+Thread Safety
+-------------
+All the game state, including the game matrix [M], is held in the MD_TTT 
+object. The only data shared between objects is the win matrix, which is 
+constant. Independent MD_TTT objects can therefore be used concurrently 
+from different threads (or interrupt contexts) without any locking. The 
+program tools/MD_TTT_Stress.cpp checks this by playing the same seeded 
+games on many threads at once and comparing them with the games played 
+on one thread.
+
+A single MD_TTT object is not protected against concurrent access. If more 
+than one thread calls methods on the same object, the calling code must 
+serialize the calls. The same applies to an MD_TTTPool, which has one 
+random generator for all its games.
 */
 #ifndef _MD_TTT_H
 #define _MD_TTT_H
 
+#ifdef ARDUINO
 #include <Arduino.h>
+#else
+#include "MD_TTT_HAL.h"   // host build without the Arduino core
+#endif
+
+/**
+ * Perfect play table switch.
+ * 
+ * Set to 1 to include the precomputed perfect play table used by the 
+ * TTT_ENGINE_TABLE auto player engine and getGameValue(). The table 
+ * takes 19,683 bytes of program memory (PROGMEM on AVR).
+ */
+#ifndef TTT_USE_TABLE
+#define TTT_USE_TABLE 0
+#endif
+
+/**
+ * Opening book switch.
+ * 
+ * Set to 1 to include the opening book and endgame table consulted by 
+ * the heuristic auto player before it scores the moves. The book takes 
+ * about 2kB of program memory (PROGMEM on AVR).
+ */
+#ifndef TTT_USE_BOOK
+#define TTT_USE_BOOK 0
+#endif
+
+/**
+ * Time-sliced auto player switch.
+ * 
+ * Set to 1 to include beginAutoMove(), stepAutoMove() and isMoveReady(), 
+ * which work out the auto player move a slice at a time. The search 
+ * state adds about 150 bytes of RAM to each MD_TTT object.
+ */
+#ifndef TTT_USE_STEP
+#define TTT_USE_STEP 0
+#endif
+
+/**
+ * Move scores switch.
+ * 
+ * Set to 1 to keep the scores for a move into each cell up to date as 
+ * each move is made, so the heuristic auto player and analyze() do not 
+ * score the board again for each move. They choose the same moves either 
+ * way.
+ * 
+ * Adds 126 bytes of RAM to each MD_TTT object (33 bytes on AVR with all 
+ * the game state switches set to 0). On a 64-bit host doMove() takes 
+ * about 40 ns longer (23 ns with all the switches set to 0) and start() 
+ * about 20 ns longer, and each heuristic auto player move about 100 ns 
+ * less.
+ */
+#ifndef TTT_USE_SCORES
+#define TTT_USE_SCORES 0
+#endif
+
+/**
+ * Board hash switch.
+ * 
+ * Set to 1 to keep the board hashes up to date as each move is made and 
+ * to include the transposition table for the search engine, see 
+ * setTransTable(). When set to 0 getBoardHash() works the hash out from 
+ * the board.
+ * 
+ * Adds 46 bytes of RAM to each MD_TTT object on AVR. On a 64-bit host 
+ * doMove() takes about 18 ns longer.
+ */
+#ifndef TTT_USE_HASH
+#define TTT_USE_HASH 0
+#endif
+
+/**
+ * Move stack switch.
+ * 
+ * Set to 1 to record the moves made on a move stack, which is needed by 
+ * undoMove(), redoMove(), serialize(), deserialize() and writeLog().
+ * 
+ * Adds 14 bytes of RAM to each MD_TTT object. On a 64-bit host doMove() 
+ * takes about 3 ns longer.
+ */
+#ifndef TTT_USE_UNDO
+#define TTT_USE_UNDO 0
+#endif
+
+/**
+ * Event queue switch.
+ * 
+ * Set to 1 to include setEventQueue() and getEvent(), which queue the 
+ * display updates in place of the move callback.
+ * 
+ * Adds 8 bytes of RAM to each MD_TTT object on AVR, as well as the 
+ * memory for the queue. On a 64-bit host doMove() takes about 3 ns longer 
+ * when no queue is set.
+ */
+#ifndef TTT_USE_EVENTS
+#define TTT_USE_EVENTS 0
+#endif
+
+/**
+ * Instrumentation switch.
+ * 
+ * Set to 1 to count what the auto player does and time the phases of 
+ * the heuristic engine, see MD_TTT::getStats(). When set to 0 the 
+ * instrumentation is removed from the library completely.
+ */
+#ifndef TTT_USE_STATS
+#define TTT_USE_STATS 0
+#endif
 
 // Miscellaneous defines
 #define ARRAY_SIZE(x) (sizeof(x)/sizeof(x[0]))
 #define CELL_ID(i)    ((char)(i+'a'))
 
 #define TTT_BOARD_SIZE  9
+#define TTT_WIN_LINES   8
+#define TTT_SYMMETRIES  8 ///< rotations and reflections of the board
 
 // Player definitions
 #define TTT_P1  1 ///< Player 1
@@ -227,12 +697,233 @@ number appears will also tell exactly where to strike through for wins.
 #define TTT_WL_V3 6 ///< Win line 3rd vertical
 #define TTT_WL_D2 7 ///< Win line diagonal right to left
 
+// Auto player engine definitions
+#define TTT_ENGINE_HEURISTIC 0 ///< Auto player uses the win weight matrix heuristic (default)
+#define TTT_ENGINE_TABLE     1 ///< Auto player uses the perfect play table (needs TTT_USE_TABLE)
+#define TTT_ENGINE_SEARCH    2 ///< Auto player uses a full negamax search of the game tree
+
+// Auto player move selection modes. The heuristic modes are tried in 
+// order until one of them selects a move.
+#define TTT_MODE_WIN     0 ///< Heuristic: the move makes a 3 (wins)
+#define TTT_MODE_2_CLEAR 1 ///< Heuristic: most 2's, leaving the opponent no 2's or 1's
+#define TTT_MODE_2_SAFE  2 ///< Heuristic: most 2's, leaving the opponent no 2's
+#define TTT_MODE_1_SAFE  3 ///< Heuristic: most 1's, leaving the opponent no 2's
+#define TTT_MODE_1       4 ///< Heuristic: most 1's
+#define TTT_MODE_FIRST   5 ///< Heuristic: no mode applied, first empty cell
+#define TTT_MODE_TABLE   6 ///< Move from the perfect play table
+#define TTT_MODE_SEARCH  7 ///< Move from the game tree search
+#define TTT_MODE_BOOK    8 ///< Move from the opening book or endgame table
+#define TTT_MODE_NONE    0xff ///< No auto player move made
+#define TTT_MODES        9    ///< The number of modes, excluding TTT_MODE_NONE
+
+// Game value definitions
+#define TTT_VAL_LOSS  -1 ///< The player loses with perfect play by both players
+#define TTT_VAL_DRAW   0 ///< The game is drawn with perfect play by both players
+#define TTT_VAL_WIN    1 ///< The player wins with perfect play by both players
+#define TTT_VAL_UNKNOWN 2 ///< The game value has not been worked out
+
+/**
+ * Board state as bitboards.
+ *
+ * A compact, stand alone description of a board used by the batch 
+ * evaluation method MD_TTT::evalBoards(). Bit i of each bitboard is 
+ * board position i [0..8].
+ */
+typedef struct
+{
+  uint16_t p1;  ///< the cells occupied by TTT_P1
+  uint16_t p2;  ///< the cells occupied by TTT_P2
+} tttBoard;
+
+/**
+ * Transposition table entry.
+ *
+ * The transposition table memory supplied to MD_TTT::setTransTable() 
+ * is divided into entries of this type.
+ */
+typedef struct
+{
+  uint16_t check;   ///< upper 16 bits of the board hash, to verify the entry
+  int8_t   score;   ///< search score for the board
+  uint8_t  bound;   ///< type of score, or 0 if the entry is empty
+} tttTransEntry;
+
+/**
+ * Move analysis.
+ *
+ * The analysis of one legal move, filled in by MD_TTT::analyze().
+ */
+typedef struct
+{
+  uint8_t cell;       ///< the board cell [0..8]
+  uint8_t mode;       ///< the first heuristic mode (TTT_MODE_*) that would select this cell
+  bool    best;       ///< true if the heuristic auto player would choose between this and the other best cells
+  int8_t  value;      ///< the game value after this move (TTT_VAL_*), TTT_VAL_UNKNOWN if not worked out
+  uint8_t scores[7];  ///< the standardized scores histogram, the number of lines valued -3 to 3 after the move
+} tttMoveInfo;
+
+#if TTT_USE_STATS
+/**
+ * Auto player instrumentation.
+ *
+ * The counts and timings accumulated by the auto player since the 
+ * last MD_TTT::resetStats(), returned by MD_TTT::getStats(). The 
+ * times are the total for all the calls, in nanoseconds. They are 64 
+ * bit so they do not overflow in practice (after 584 years), where 32 
+ * bits would after 4.3 seconds. On Arduino the times are measured with 
+ * micros(), so are only accurate over many calls.
+ */
+typedef struct
+{
+  uint32_t calls;       ///< the number of auto player moves
+  uint32_t modeHits[TTT_MODES]; ///< the number of moves selected by each TTT_MODE_*
+  uint32_t tieBreaks;   ///< the number of moves chosen at random from more than one tied cell
+  uint64_t timeScore;   ///< time updating the scores histograms in doMove(), or the line sets in doAutoMove()
+  uint64_t timeSelect;  ///< heuristic time selecting the move from the scores
+} tttStats;
+#endif
+
+// Event types, see Event Queue
+#define TTT_EVT_CELL  0   ///< a board cell changed, see tttEvent
+#define TTT_EVT_CLEAR 1   ///< the board was cleared for a new game
+#define TTT_EVT_OVER  2   ///< the game is over, see tttEvent
+#define TTT_EVT_SYNC  3   ///< events were lost as the queue was full, redraw the whole board
+#define TTT_EVT_RESUME 4  ///< undoMove() took back the end of the game, it is in play again
+
+/**
+ * Game event.
+ *
+ * An event taken from the event queue by MD_TTT::getEvent().
+ */
+typedef struct
+{
+  uint8_t type;   ///< the event type, one of TTT_EVT_*
+  uint8_t pos;    ///< TTT_EVT_CELL the cell [0..8], TTT_EVT_OVER the winning line (TTT_WL_*) or 0xff
+  int8_t  player; ///< TTT_EVT_CELL the player now in the cell, TTT_EVT_OVER the winner, one of TTT_P*
+} tttEvent;
+
+// Move log record format, see Move Logs
+#define TTT_LOG_HEADER      6   ///< bytes in a move log record header
+#define TTT_LOG_MAX_SIZE    (TTT_LOG_HEADER + (TTT_BOARD_SIZE + 1) / 2) ///< largest move log record
+
+/**
+ * Move log replay result.
+ *
+ * The result of replaying one game record from a move log with 
+ * MD_TTT::replayLog().
+ */
+typedef struct
+{
+  uint32_t seed;      ///< the random generator state at the start of the game
+  uint8_t  length;    ///< the number of bytes in the record
+  uint8_t  moves;     ///< the number of moves in the game
+  int8_t   autoPlayer; ///< the auto player, one of TTT_P*
+  uint8_t  autoEngine; ///< the auto player engine, one of TTT_ENGINE_*
+  bool     valid;     ///< false if the record is damaged or a move is not legal
+  bool     gameOver;  ///< true if the game was finished
+  int8_t   winner;    ///< the winner, one of TTT_P*
+  uint8_t  winLine;   ///< the winning line, one of TTT_WL_* or 0xff
+} tttGameResult;
+
+// Serialized game state format, see Saving and Restoring Games
+#define TTT_SERIAL_VERSION  2   ///< version of the serialized game format
+#define TTT_SERIAL_SIZE     28  ///< bytes in a serialized game
+
+#define TTT_SER_VERSION 0   ///< offset of the format version
+#define TTT_SER_P1      1   ///< offset of the TTT_P1 bitboard, 2 bytes LSB first
+#define TTT_SER_P2      3   ///< offset of the TTT_P2 bitboard, 2 bytes LSB first
+#define TTT_SER_AUTO    5   ///< offset of the auto player
+#define TTT_SER_ENGINE  6   ///< offset of the auto player engine
+#define TTT_SER_WINLINE 7   ///< offset of the winning line
+#define TTT_SER_WINNER  8   ///< offset of the winning player
+#define TTT_SER_FLAGS   9   ///< offset of the flags (bit 0 is game over)
+#define TTT_SER_RANDOM  10  ///< offset of the random generator state, 4 bytes LSB first
+#define TTT_SER_START   14  ///< offset of the random generator state at start(), 4 bytes LSB first
+#define TTT_SER_MOVETOP 18  ///< offset of the number of moves on the move stack
+#define TTT_SER_MOVES   19  ///< offset of the move stack, TTT_BOARD_SIZE bytes
+
+/**
+ * Serialized game reader.
+ *
+ * Reads the fields of a game serialized by MD_TTT::serialize() directly 
+ * from the buffer, without copying it or creating an MD_TTT object. The 
+ * buffer must remain valid while it is in use.
+ */
+class tttStateView
+{
+  public:
+  /**
+   * Create a view of a serialized game.
+   *
+   * \param buf   the serialized game.
+   * \param size  the number of bytes in the buffer.
+   */
+  tttStateView(const uint8_t *buf, uint8_t size) : _buf(buf), _size(size) {}
+
+  /**
+   * Check if the buffer holds a game this version can read.
+   *
+   * Only checks the size and format version. MD_TTT::deserialize() also 
+   * checks the contents are consistent.
+   *
+   * \return true if the buffer can be read.
+   */
+  bool isValid(void) const { return(_buf != NULL && _size >= TTT_SERIAL_SIZE && _buf[TTT_SER_VERSION] == TTT_SERIAL_VERSION); }
+
+  uint16_t getBoardP1(void) const { return(_buf[TTT_SER_P1] | (_buf[TTT_SER_P1+1] << 8)); }  ///< the cells occupied by TTT_P1 as a bitboard
+  uint16_t getBoardP2(void) const { return(_buf[TTT_SER_P2] | (_buf[TTT_SER_P2+1] << 8)); }  ///< the cells occupied by TTT_P2 as a bitboard
+  int8_t getAutoPlayer(void) const { return((int8_t)_buf[TTT_SER_AUTO]); }     ///< the auto player, one of TTT_P*
+  uint8_t getAutoEngine(void) const { return(_buf[TTT_SER_ENGINE]); }          ///< the auto player engine, one of TTT_ENGINE_*
+  uint8_t getWinLine(void) const { return(_buf[TTT_SER_WINLINE]); }            ///< the winning line, one of TTT_WL_* or 0xff
+  int8_t getGameWinner(void) const { return((int8_t)_buf[TTT_SER_WINNER]); }   ///< the winner, one of TTT_P*
+  bool isGameOver(void) const { return(_buf[TTT_SER_FLAGS] & 1); }             ///< true if the game is over
+  uint32_t getRandomState(void) const ///< the random generator state
+    { return(_buf[TTT_SER_RANDOM] | ((uint32_t)_buf[TTT_SER_RANDOM+1] << 8) | ((uint32_t)_buf[TTT_SER_RANDOM+2] << 16) | ((uint32_t)_buf[TTT_SER_RANDOM+3] << 24)); }
+  uint32_t getStartRandom(void) const ///< the random generator state at start(), the move log seed
+    { return(_buf[TTT_SER_START] | ((uint32_t)_buf[TTT_SER_START+1] << 8) | ((uint32_t)_buf[TTT_SER_START+2] << 16) | ((uint32_t)_buf[TTT_SER_START+3] << 24)); }
+
+  /**
+   * Get the occupier of a board position.
+   *
+   * \param pos the position to check [0..8].
+   * \return the player identifier, one of TTT_P*.
+   */
+  int8_t getBoardPosition(uint8_t pos) const
+  { 
+    if (pos >= TTT_BOARD_SIZE) return(TTT_P0);
+    if (getBoardP1() & (1 << pos)) return(TTT_P1);
+    if (getBoardP2() & (1 << pos)) return(TTT_P2);
+    return(TTT_P0);
+  }
+
+  /**
+   * Get the number of moves made.
+   *
+   * \return the number of cells occupied [0..9].
+   */
+  uint8_t getMoveCount(void) const
+  {
+    uint8_t n = 0;
+
+    for (uint16_t b = getBoardP1() | getBoardP2(); b != 0; b &= b - 1)
+      n++;
+
+    return(n);
+  }
+
+  private:
+  const uint8_t *_buf;  ///< the serialized game
+  uint8_t _size;        ///< the size of the buffer
+};
+
 /**
  * Core object for the MD_TTT library.
  * This class contains all logic and status information for the game.
  */
 class MD_TTT 
 {
+  friend class MD_TTTPool;  // uses the heuristic move selection
+
   public:
   //--------------------------------------------------------------
   /** \name Methods for Setup and Initialization.
@@ -269,6 +960,43 @@ class MD_TTT
    */
   ~MD_TTT(void);
 
+#if TTT_USE_EVENTS
+  /**
+   * Set the event queue memory.
+   *
+   * Once an event queue is set, the game pushes events into the queue in 
+   * place of invoking the callback, and the user code takes them out with 
+   * getEvent() when it is ready to update the display. The game never 
+   * waits for the user code. start() queues a single TTT_EVT_CLEAR event 
+   * rather than an event for each cell, and a TTT_EVT_CLEAR is not queued 
+   * again if nothing else has happened since the last one.
+   *
+   * The queue is a single producer, single consumer ring buffer with one 
+   * byte for each event. The game may run in a different thread (or 
+   * interrupt) to the code that calls getEvent() without any locking. If 
+   * the queue fills up, the new events are lost and getEvent() returns 
+   * TTT_EVT_SYNC. The memory must remain valid while it is in use. Pass 
+   * NULL to go back to the callback.
+   *
+   * \param buf   pointer to the memory for the queue, or NULL.
+   * \param size  the size of the memory in bytes, rounded down to a power of 2 [2..128].
+   * \return true if no errors occurred, false otherwise.
+   */
+  bool setEventQueue(uint8_t *buf, uint8_t size);
+
+  /**
+   * Take the next event from the event queue.
+   *
+   * Events are returned in the order they happened. A TTT_EVT_SYNC event 
+   * means that events were lost and the whole board should be drawn 
+   * again from getBoardPosition() and the game status.
+   *
+   * \param pEvent pointer to the event to fill in.
+   * \return true if an event was returned, false if the queue is empty.
+   */
+  bool getEvent(tttEvent *pEvent);
+#endif
+
   /** @} */
   //--------------------------------------------------------------
   /** \name Methods for Game Management.
@@ -295,13 +1023,56 @@ class MD_TTT
    * to the auto player, then _pos_ is ignored and the libraries 
    * make a decision on the next move for this player. The user callback 
    * function is always invoked after the move is completed and all game 
-   * status values have been settled.
+   * status values have been settled, unless _silent_ is true.
+   *
+   * Each move is recorded on the move stack, so it can be taken back 
+   * with undoMove(). Making a move discards any moves that could have 
+   * been redone with redoMove().
    *
    * \param pos position on the board for the move [0..8].
    * \param player  player identifier TT_P1 or TT_P2.
+   * \param silent  set true to skip the callback (eg, when looking ahead).
    * \return true if no errors occurred, false otherwise.
    */
-  bool doMove(uint8_t pos, int8_t player);
+  bool doMove(uint8_t pos, int8_t player, bool silent = false);
+
+#if TTT_USE_UNDO
+  /**
+   * Take back the last move.
+   *
+   * Removes the last move made from the board and restores the game 
+   * status to what it was before that move. The move is kept on the 
+   * move stack so it can be made again with redoMove(). Unless _silent_ 
+   * is true, the user callback is invoked for the cell with TTT_P0 as 
+   * the player, as the cell is now empty.
+   *
+   * \param silent  set true to skip the callback (eg, when looking ahead).
+   * \return true if a move was taken back, false if there are no moves.
+   */
+  bool undoMove(bool silent = false);
+
+  /**
+   * Make the last move taken back again.
+   *
+   * Makes the move most recently taken back by undoMove() again, for 
+   * the same player. Unless _silent_ is true, the user callback is 
+   * invoked as for doMove(). The auto player is not consulted.
+   *
+   * \param silent  set true to skip the callback (eg, when looking ahead).
+   * \return true if a move was made, false if there are no moves to redo.
+   */
+  bool redoMove(bool silent = false);
+#endif
+
+  /**
+   * Get the number of moves made.
+   *
+   * Returns the number of moves on the board, which is also the number 
+   * of moves that can be taken back with undoMove().
+   *
+   * \return the number of moves made [0..9].
+   */
+  uint8_t getMoveCount(void) {return TTT_BOARD_SIZE - _movesLeft;}
 
   /**
    * Set the computer player.
@@ -311,10 +1082,18 @@ class MD_TTT
    * then the library will never invoke the move generation logic for any 
    * player in doMove().
    *
+   * The engine used to generate the moves is selected by one of the 
+   * TTT_ENGINE_* identifiers. The default is the heuristic described in 
+   * the documentation. TTT_ENGINE_TABLE looks up the move in the perfect 
+   * play table, and is only available if TTT_USE_TABLE is set to 1. 
+   * TTT_ENGINE_SEARCH searches the game tree for a perfect move, which 
+   * takes more time but no extra memory.
+   *
    * \param player  player identifier TT_P1 or TT_P2.
+   * \param engine  engine identifier, one of TTT_ENGINE_*.
    * \return true if no errors occurred, false otherwise.
    */  
-  bool setAutoPlayer(int8_t player);
+  bool setAutoPlayer(int8_t player, uint8_t engine = TTT_ENGINE_HEURISTIC);
 
   /**
    * Get the computer player id.
@@ -327,6 +1106,199 @@ class MD_TTT
    */
   int8_t getAutoPlayer(void) {return _autoPlayer;}
 
+  /**
+   * Get the computer player engine.
+   *
+   * Returns the engine used to generate moves for the auto player. 
+   * This would have previously been set by a call to setAutoPlayer().
+   *
+   * \return the engine identifier, one of TTT_ENGINE_*.
+   */
+  uint8_t getAutoEngine(void) {return _autoEngine;}
+
+  /**
+   * Get how the last computer move was selected.
+   *
+   * Returns how the last auto player move was selected. For the heuristic 
+   * this is the criterion (tryMode) that selected the move, which is a 
+   * measure of how the game is going. It is TTT_MODE_NONE after start() 
+   * and until the auto player makes a move.
+   *
+   * \return the mode identifier, one of TTT_MODE_*.
+   */
+  uint8_t getAutoMode(void) {return _autoMode;}
+
+  /**
+   * Get the search node count.
+   *
+   * Returns the number of board positions examined by the last move 
+   * of the TTT_ENGINE_SEARCH engine. This is mainly useful to measure 
+   * the performance of the search.
+   *
+   * \return the number of nodes searched.
+   */
+  uint32_t getSearchNodes(void) {return _searchNodes;}
+
+#if TTT_USE_HASH
+  /**
+   * Set the transposition table memory.
+   *
+   * The TTT_ENGINE_SEARCH engine can remember the boards it has already 
+   * searched in a transposition table, so that a board reached by a 
+   * different sequence of moves, or that is a rotation or reflection of 
+   * a board already searched, is not searched again. This cuts the number 
+   * of nodes searched, especially for the first moves of the game.
+   *
+   * The table uses the memory supplied by the calling program, so the 
+   * size can be chosen to suit the memory available. Each entry takes 
+   * sizeof(tttTransEntry) bytes, the number of entries is rounded down to 
+   * a power of 2 and, except on AVR, the table is aligned to a 64 byte 
+   * cache line. 512 entries (2kB) hold all the boards for a complete game 
+   * with few collisions. The memory must remain valid while it is in use. 
+   * Pass NULL to stop using a transposition table.
+   *
+   * \param buf   pointer to the memory for the table, or NULL.
+   * \param size  the size of the memory in bytes.
+   * \return true if no errors occurred, false otherwise.
+   */
+  bool setTransTable(void *buf, size_t size);
+
+  /**
+   * Get the transposition table probe count.
+   *
+   * Returns the number of times the transposition table was checked 
+   * for a board during the last search.
+   *
+   * \return the number of probes.
+   */
+  uint32_t getTransProbes(void) {return _ttProbes;}
+
+  /**
+   * Get the transposition table hit count.
+   *
+   * Returns the number of times the transposition table provided the 
+   * score for a board during the last search. The hit rate is this 
+   * value divided by getTransProbes().
+   *
+   * \return the number of hits.
+   */
+  uint32_t getTransHits(void) {return _ttHits;}
+#endif
+
+  /**
+   * Seed the random number generator.
+   *
+   * When more than one move is equally good the auto player chooses 
+   * between them randomly, using a random number generator kept in the 
+   * MD_TTT object. If the generator is not seeded it is seeded from the 
+   * time when start() is called, so games cannot be repeated. Setting 
+   * the seed makes the sequence of random choices, and therefore the 
+   * games played by the auto player, repeatable.
+   *
+   * \param seed  the seed value. Any value is valid.
+   */
+  void setSeed(uint32_t seed);
+
+  /**
+   * Get the random number generator state.
+   *
+   * Returns the current state of the random number generator. Saving this 
+   * with the board and later restoring it with setRandomState() allows the 
+   * auto player to make the same choices again from that point.
+   *
+   * \return the generator state, 0 if the generator has not been seeded.
+   */
+  uint32_t getRandomState(void) {return _random;}
+
+  /**
+   * Set the random number generator state.
+   *
+   * Restores the state of the random number generator previously saved 
+   * with getRandomState(). Unlike setSeed(), the value is used as is.
+   *
+   * \param state the generator state.
+   */
+  void setRandomState(uint32_t state);
+
+#if TTT_USE_STATS
+  /**
+   * Get the auto player statistics.
+   *
+   * Copies the counts and timings accumulated by the auto player since 
+   * the object was created or resetStats() was last called into the 
+   * structure supplied, so they can be examined while the game goes 
+   * on. This method is only available if TTT_USE_STATS is set to 1.
+   *
+   * \param pStats pointer to the structure for the statistics.
+   */
+  void getStats(tttStats *pStats);
+
+  /**
+   * Reset the auto player statistics.
+   *
+   * Sets all the counts and timings returned by getStats() to zero. 
+   * This method is only available if TTT_USE_STATS is set to 1.
+   */
+  void resetStats(void);
+#endif
+
+#if TTT_USE_STEP
+  /**
+   * Start working out the auto player move.
+   *
+   * Starts working out the next move for the auto player on the board as 
+   * it stands, without making it. The work is then done in slices by 
+   * stepAutoMove(), so a sketch can keep its display and inputs running 
+   * while the TTT_ENGINE_SEARCH engine searches. The other engines take 
+   * very little time, so their move is ready as soon as this returns.
+   *
+   * Once isMoveReady() is true, doMove() for the auto player makes the 
+   * move that was worked out rather than working it out again. If the 
+   * board is changed before then, the move is abandoned and 
+   * beginAutoMove() must be called again. This method is only available 
+   * if TTT_USE_STEP is set to 1.
+   *
+   * \return true if the move was started, false if there is no auto player or the game is over.
+   */
+  bool beginAutoMove(void);
+
+  /**
+   * Continue working out the auto player move.
+   *
+   * Does the work to find the move started by beginAutoMove() for about 
+   * _budget_ microseconds and returns. The time is checked every few 
+   * board positions, so a call may take a little longer than _budget_, 
+   * and each call does some work even if _budget_ is 0. The search 
+   * state is kept in the MD_TTT object, and between calls the board is 
+   * as it was when the move was started. This method is only available 
+   * if TTT_USE_STEP is set to 1.
+   *
+   * \param budget  the time for this slice of the work in microseconds.
+   * \return true if the move is ready, false if there is more to do or the move was abandoned.
+   */
+  bool stepAutoMove(uint32_t budget);
+
+  /**
+   * Check if the auto player move is ready.
+   *
+   * This method is only available if TTT_USE_STEP is set to 1.
+   *
+   * \return true if the move started by beginAutoMove() has been worked out and the board has not changed.
+   */
+  bool isMoveReady(void);
+
+  /**
+   * Get the auto player move.
+   *
+   * Returns the cell for the move worked out by beginAutoMove() and 
+   * stepAutoMove(), which doMove() will make for the auto player. This 
+   * method is only available if TTT_USE_STEP is set to 1.
+   *
+   * \return the cell [0..8], or 0xff if the move is not ready.
+   */
+  uint8_t getAutoMove(void);
+#endif
+
   /** @} */
   //--------------------------------------------------------------
   /** \name Methods for Board Management.
@@ -359,12 +1331,45 @@ class MD_TTT
    * check isGameOver() to ensure that the winning line returned is valid. 
    * The winning line will be one of the identifiers TTT_WL_* in MD_TTT.h.
    * The function should be used to easily determine which line to 
-   * ‘strike out’ at the end of the game.
+   * ‘strike out’ at the end of the game. If the winning move completed 
+   * two lines this is the higher numbered one.
    *
    * \return the winning line id, one of TTT_WL_*.
    */
   uint8_t getWinLine(void) {return _winLine;}
 
+  /**
+   * Get the cells that have changed.
+   *
+   * The library keeps a bitboard of the cells that have changed since 
+   * the last clearDirty(), so a display only needs to draw those cells 
+   * again. All the cells are dirty when the object is created. start() 
+   * marks the cells that were occupied, and moves (made, taken back or 
+   * redone, silent or not) and deserialize() mark the cells they change.
+   *
+   * \return bitboard of the changed cells, bit i is cell i.
+   */
+  uint16_t getDirty(void) {return _dirty;}
+
+  /**
+   * Clear the changed cells.
+   *
+   * Called by the display code once it has drawn the changed cells.
+   */
+  void clearDirty(void) {_dirty = 0;}
+
+  /**
+   * Get the board generation.
+   *
+   * The generation counts the changes to the board and wraps around at 
+   * 65535. It is not reset by clearDirty(), so a display (or several) 
+   * can check whether the board has changed since it was last drawn by 
+   * comparing this with the generation it last saw.
+   *
+   * \return the board generation.
+   */
+  uint16_t getGeneration(void) {return _generation;}
+
   /**
    * Get the occupier of a board position
    *
@@ -377,22 +1382,294 @@ class MD_TTT
    */
   int8_t getBoardPosition(uint8_t pos);
 
+  /**
+   * Get the board hash
+   *
+   * Returns a 32 bit Zobrist hash of the board, which is the same for all 
+   * the rotations and reflections of the board. The hash is updated 
+   * incrementally as each move is made, so this is a quick way to compare 
+   * or look up boards.
+   *
+   * \return the canonical hash for the board.
+   */
+  uint32_t getBoardHash(void);
+
+#if TTT_USE_TABLE
+  /**
+   * Get the value of the game
+   *
+   * Returns the game theoretic value of the current board for _player_ 
+   * if it is their turn to move, assuming both players play perfectly 
+   * from now on. The value is looked up in the perfect play table, so 
+   * this method is only available if TTT_USE_TABLE is set to 1.
+   *
+   * \param player  player identifier TT_P1 or TT_P2.
+   * \return the game value, one of TTT_VAL_*.
+   */
+  int8_t getGameValue(int8_t player);
+#endif
+
+  /**
+   * Analyze the moves for a player.
+   *
+   * Fills _moves_ with every legal move for _player_, best first, as 
+   * a hint or to explain the auto player. For each move this gives the 
+   * heuristic mode (TTT_MODE_*) that would select it, its standardized 
+   * scores histogram and whether it is one of the cells the heuristic 
+   * auto player would choose between. The histograms are the ones kept 
+   * up to date by doMove(), so nothing is scored again. The opening book 
+   * (TTT_USE_BOOK) is not consulted.
+   *
+   * If _exact_ is true each move is also searched to find its game value 
+   * with perfect play, and the moves are ranked by game value (the 
+   * soonest win first) before the heuristic order. This takes the time 
+   * of a TTT_ENGINE_SEARCH move and the nodes searched are returned by 
+   * getSearchNodes(). Otherwise the value is TTT_VAL_UNKNOWN and the 
+   * moves are in the heuristic order.
+   *
+   * An array of TTT_BOARD_SIZE entries always holds all the moves. If 
+   * _size_ is smaller only the best _size_ moves are returned.
+   *
+   * \param player  player identifier TTT_P1 or TTT_P2.
+   * \param moves   the array for the moves.
+   * \param size    the number of entries in the array.
+   * \param exact   true to search for the game value of each move.
+   * \return the number of legal moves, 0 if the game is over.
+   */
+  uint8_t analyze(int8_t player, tttMoveInfo *moves, uint8_t size, bool exact = false);
+
+#if TTT_USE_UNDO
+  /**
+   * Save the game.
+   *
+   * Writes the complete game state, including the move stack used by 
+   * undoMove(), the auto player and the random generator state, to 
+   * _buf_ in a fixed binary format of TTT_SERIAL_SIZE bytes that is 
+   * the same on all processors. See Saving and Restoring Games in the 
+   * documentation for the format.
+   *
+   * \param buf   the buffer for the serialized game.
+   * \param size  the size of the buffer in bytes.
+   * \return the number of bytes written, 0 if the buffer is too small.
+   */
+  uint8_t serialize(uint8_t *buf, uint8_t size);
+
+  /**
+   * Restore a saved game.
+   *
+   * Restores the game state saved by serialize(), here or on another 
+   * device. The game matrix and the other working values are rebuilt 
+   * directly from the board, without replaying the moves. Unless _silent_ 
+   * is true, the user callback is invoked for every cell, as for start().
+   * If the data is not valid the game is not changed. Data is not valid 
+   * if the move stack does not give the board, or the win flags, winner, 
+   * winning line or game over flag are not what the moves would give, or 
+   * the auto player engine is not one setAutoPlayer() accepts.
+   *
+   * \param buf   the serialized game.
+   * \param size  the number of bytes in the buffer.
+   * \param silent  set true to skip the callbacks.
+   * \return true if the game was restored, false if the data is not valid.
+   */
+  bool deserialize(const uint8_t *buf, uint8_t size, bool silent = false);
+
+  /**
+   * Write the game to a move log.
+   *
+   * Encodes the moves made so far in the game as a move log record of 
+   * at most TTT_LOG_MAX_SIZE bytes. The record holds the auto player, 
+   * the random generator state when start() was called and each move in 
+   * 4 bits, so records for complete games can be appended one after the 
+   * other to a log. See Move Logs in the documentation for the format. 
+   * The players must have taken turns for the game to be logged.
+   *
+   * \param buf   the buffer for the record.
+   * \param size  the size of the buffer in bytes.
+   * \return the number of bytes written, 0 if the buffer is too small or the players did not take turns.
+   */
+  uint8_t writeLog(uint8_t *buf, uint8_t size);
+#endif
+
+  /** @} */
+  //--------------------------------------------------------------
+  /** \name Methods for Batch Evaluation.
+   * @{
+   */
+
+  /**
+   * Evaluate a batch of boards
+   *
+   * Works out the auto player move on each of _count_ boards for the 
+   * player to move on that board, without needing an MD_TTT object for 
+   * each game or changing the state of any object. This is intended for 
+   * the analysis of large numbers of games, where calling doMove() one 
+   * board at a time is too slow.
+   *
+   * For each board the winner, if any, is returned in the corresponding 
+   * element of _winner_ (one of TTT_P*). The best move is returned in the 
+   * corresponding element of _move_, or 0xff if the board is already won 
+   * or full. Moves are selected using the heuristic engine, with ties 
+   * resolved to the lowest numbered cell so the results are repeatable.
+   *
+   * The player to move on each board is given in the corresponding 
+   * element of _player_. If _player_ is NULL it is worked out from the 
+   * number of cells each player holds, taking TTT_P1 to have moved first: 
+   * TTT_P2 moves if TTT_P1 holds more cells, otherwise TTT_P1 moves.
+   *
+   * \param board   array of count boards to evaluate.
+   * \param count   number of boards in the arrays.
+   * \param player  array of count player identifiers, TTT_P1 or TTT_P2 for the player to move, or NULL.
+   * \param move    array of count elements for the best moves.
+   * \param winner  array of count elements for the winners.
+   */
+  static void evalBoards(const tttBoard *board, size_t count, const int8_t *player, uint8_t *move, int8_t *winner);
+
+  /**
+   * Replay the games in a move log.
+   *
+   * Replays each of the game records in the _size_ bytes of _log_, 
+   * checking that every move is legal and working out the result of 
+   * the game. The games are replayed on bitboards only, without an 
+   * MD_TTT object or callbacks, so a log in memory (or a memory mapped 
+   * file) is replayed as fast as possible.
+   *
+   * The result for each game is written to the corresponding element 
+   * of _result_, for up to _count_ games. _result_ may be NULL to just 
+   * check the log.
+   *
+   * \param log     the move log.
+   * \param size    the number of bytes in the log.
+   * \param result  array of count elements for the game results, or NULL.
+   * \param count   the number of elements in result.
+   * \return the number of games in the log. Replay stops at a damaged record.
+   */
+  static uint32_t replayLog(const uint8_t *log, uint32_t size, tttGameResult *result, uint32_t count);
+
   /** @} */
 
   protected:
-  int8_t  _board[TTT_BOARD_SIZE];  ///< the game board
+  uint16_t _boardP1;      ///< the cells occupied by TTT_P1 as a bitboard (bit i is cell i)
+  uint16_t _boardP2;      ///< the cells occupied by TTT_P2 as a bitboard
+  int8_t  _currState[TTT_WIN_LINES]; ///< the game matrix [M], sum of the win contributions for each line
+#if TTT_USE_SCORES
+  uint8_t _scores[2][TTT_BOARD_SIZE][7]; ///< standardized scores histograms for a move in each cell by TTT_P1 [0] and TTT_P2 [1]
+#endif
+#if TTT_USE_HASH
+  uint32_t _hash[TTT_SYMMETRIES];   ///< Zobrist hash of the board for each symmetry
+#endif
   uint8_t _movesLeft;     ///< the number of moves left in the game
   bool    _gameOver;      ///< flag to know when the game is over
   int8_t  _gameWinner;    ///< id of player who won
   uint8_t _winLine;       ///< the winning line (TTT_WL_*) or 0xff
+#if TTT_USE_UNDO
+  uint8_t _moveStack[TTT_BOARD_SIZE]; ///< the moves made, in order (cell, player and win flag)
+  uint8_t _moveTop;       ///< the number of valid moves on the stack, including those that can be redone
+#endif
+  uint16_t _dirty;        ///< the cells changed since clearDirty() as a bitboard
+  uint16_t _generation;   ///< the number of changes to the board
   int8_t  _autoPlayer;    ///< the computer player (TTT_P0 if neither)
+  uint8_t _autoEngine;    ///< the engine used by the computer player (TTT_ENGINE_*)
+  uint8_t _autoMode;      ///< how the last auto player move was selected (TTT_MODE_*)
+  uint32_t _searchNodes;  ///< the number of nodes examined by the last search
+  uint32_t _random;       ///< xorshift32 random generator state, 0 if not seeded
+#if TTT_USE_UNDO
+  uint32_t _startRandom;  ///< random generator state at the start of the game
+#endif
+#if TTT_USE_HASH
+  tttTransEntry *_ttTable; ///< the transposition table, or NULL if none
+  uint32_t _ttMask;       ///< the transposition table index mask (entries - 1)
+  uint32_t _ttProbes;     ///< transposition table probes in the last search
+  uint32_t _ttHits;       ///< transposition table hits in the last search
+#endif
+#if TTT_USE_STATS
+  tttStats _stats;        ///< auto player instrumentation
+#endif
+#if TTT_USE_STEP
+  /// State of one board in the time-sliced search, as the local variables of negamax()
+  typedef struct
+  {
+    uint8_t order[TTT_BOARD_SIZE];  ///< the empty cells, most promising first
+    uint8_t count;    ///< the number of cells in order
+    uint8_t n;        ///< the index in order of the move being searched
+    int8_t  best;     ///< the best score so far
+    int8_t  alpha;    ///< alpha-beta window
+    int8_t  beta;     ///< alpha-beta window
+    int8_t  alphaIn;  ///< alpha at the start, to classify the transposition table score
+  } stepFrame;
+
+  stepFrame _stepFrame[TTT_BOARD_SIZE]; ///< search state for each board on the path from the root
+  uint8_t  _stepDepth;    ///< the number of frames in use
+  uint8_t  _stepState;    ///< time-sliced move state
+  uint8_t  _stepMove;     ///< the best move found so far
+  int8_t   _stepPlayer;   ///< the player the move is for
+  uint16_t _stepP1;       ///< TTT_P1 bitboard when the move was started
+  uint16_t _stepP2;       ///< TTT_P2 bitboard when the move was started
+#endif
 
   void (*_cbMoveHandler)(uint8_t pos, int8_t player); ///< callback into user code to process the move
 
+#if TTT_USE_EVENTS
+  uint8_t *_evtQueue;         ///< the event queue, or NULL to use the callback
+  uint8_t _evtMask;           ///< the event queue index mask (size - 1)
+  volatile uint8_t _evtHead;  ///< the number of events pushed, written by the game only
+  volatile uint8_t _evtTail;  ///< the number of events taken, written by getEvent() only
+  volatile uint8_t _evtLost;  ///< the number of times events were lost, written by the game only
+  uint8_t _evtSeen;           ///< _evtLost when getEvent() last returned TTT_EVT_SYNC
+  uint8_t _evtLast;           ///< the last event pushed
+#endif
+
   uint8_t doAutoMove(int8_t player);        ///< work out a move for the auto player
+  uint8_t makeMove(uint8_t pos, int8_t player);   ///< silently make a move, returns the line won or 0xff
+  void unmakeMove(uint8_t pos, int8_t player);    ///< silently reverse makeMove()
+#if TTT_USE_HASH
+  void updateHash(uint8_t pos, int8_t player);    ///< toggle the player in the cell in the board hashes
+#endif
+  void pushMove(uint8_t pos, int8_t player);      ///< make a move, record it and update the game status
+#if TTT_USE_UNDO
+  void rebuildState(void);                        ///< work out the game matrix, hashes and scores from the bitboards
+#endif
+#if TTT_USE_SCORES
+  void scoreCell(uint8_t k);                      ///< work out the scores histograms for a cell
+  void updateScores(uint8_t pos, int8_t delta, uint16_t cells); ///< update the cells histograms for a change in the lines through pos
+#else
+  void boardScores(uint8_t scores[][7], int8_t player); ///< work out the standardized scores histograms for a player's move in each empty cell
+#endif
+#if TTT_USE_EVENTS
+  void pushEvent(uint8_t evt);                    ///< add an encoded event to the event queue
+#endif
+  void notifyCell(uint8_t pos, int8_t player);    ///< tell the user code a cell changed
+  void notifyClear(void);                         ///< tell the user code the board was cleared
+  void notifyOver(void);                          ///< tell the event queue if the game is over
+  void notifyResume(void);                        ///< tell the event queue if the game is no longer over
+
+  uint8_t searchMove(int8_t player);        ///< work out a move by searching the game tree
+  int8_t negamax(int8_t player, int8_t alpha, int8_t beta, uint8_t *pMove); ///< search the game tree
+  uint8_t orderMoves(uint8_t *order, int8_t player); ///< list the empty cells, most promising first
+#if TTT_USE_HASH
+  bool ttProbe(int8_t player, int8_t *pAlpha, int8_t *pBeta, int8_t *pScore); ///< look up the board in the transposition table
+  void ttStore(int8_t player, int8_t score, int8_t alpha, int8_t beta); ///< remember the board score in the transposition table
+#endif
+#if TTT_USE_STEP
+  bool stepEnter(uint8_t d, int8_t player, int8_t alpha, int8_t beta, int8_t *pScore); ///< set up a time-sliced search frame
+  void stepScore(uint8_t d, int8_t score);  ///< record the score of the move being searched in a frame
+#endif
 
-  void unpackByte(uint8_t *pb, uint8_t b);  ///< unpack the byte into the array
-  bool randomChoice(void);                  ///< return true or false randomly
+  static uint32_t scrambleSeed(uint32_t seed); ///< random generator state for a seed
+  static uint8_t randomChoice(uint32_t *pRandom, uint8_t n); ///< return a random number [0..n-1]
+  static void lineSets(uint8_t sets[7], const int8_t *state, int8_t player); ///< work out the standardized set of lines with each score
+  static void scoreMoves(uint8_t scores[][7], const uint8_t sets[7], uint16_t empty); ///< work out the standardized move scores histograms
+  static uint16_t moveKey(const uint8_t s[7], uint8_t k); ///< sort key for a move from its scores, larger is better
+  static uint16_t lineKey(const uint8_t sets[7], uint8_t k); ///< sort key for a move from the line sets
+  static uint8_t selectMove(uint8_t scores[][7], uint16_t empty, uint32_t *pRandom, uint8_t *pMode = NULL, uint8_t *pTies = NULL); ///< select the best move from the scores
+  static uint8_t selectMove(const uint8_t sets[7], uint16_t empty, uint32_t *pRandom, uint8_t *pMode = NULL, uint8_t *pTies = NULL); ///< select the best move from the line sets
+  static uint8_t selectKey(const uint16_t *key, uint16_t empty, uint32_t *pRandom, uint8_t *pMode, uint8_t *pTies); ///< select the move with the best key
+  static int8_t evalBoard(uint16_t p1, uint16_t p2, int8_t player, uint8_t sets[7]); ///< winner and line sets for a board
+#if TTT_USE_TABLE
+  uint8_t tableEntry(int8_t player);        ///< look up the perfect play table entry for the board
+#endif
+#if TTT_USE_BOOK
+  uint16_t bookMoves(int8_t player);        ///< look up the best moves for the board in the book
+#endif
 };
 
 #endif
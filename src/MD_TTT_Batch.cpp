@@ -0,0 +1,70 @@
+/*
+  MD_TTT_Batch.cpp - Arduino library for TicTacToe game decision engine
+  Copyright (C) 2013 Marco Colli
+  All rights reserved.
+
+  Batch evaluation of boards without an MD_TTT object.
+
+  See MD_TTT.h for complete comments
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <MD_TTT.h>
+#include "MD_TTT_lib.h"
+
+int8_t MD_TTT::evalBoard(uint16_t p1, uint16_t p2, int8_t player, uint8_t sets[7])
+// Work out the winner and the standardized line sets for the board
+{
+  int8_t state[TTT_WIN_LINES];
+
+  for (uint8_t i=0; i<TTT_WIN_LINES; i++)
+  {
+    uint16_t cells = pgm_read_word(&TTT_wlm[i]);
+    uint16_t l1 = p1 & cells;
+    uint16_t l2 = p2 & cells;
+
+    if (l1 == cells) return(TTT_P1);
+    if (l2 == cells) return(TTT_P2);
+    state[i] = countBits(l1) - countBits(l2);
+  }
+
+  lineSets(sets, state, player);
+
+  return(TTT_P0);
+}
+
+void MD_TTT::evalBoards(const tttBoard *board, size_t count, const int8_t *player, uint8_t *move, int8_t *winner)
+{
+  uint8_t sets[7];
+
+  for (size_t n=0; n<count; n++)
+  {
+    uint16_t empty = ~(board[n].p1 | board[n].p2) & TTT_BOARD_MASK;
+    int8_t p;
+
+    // without a player for each board, TTT_P1 moved first
+    if (player != NULL)
+      p = player[n];
+    else
+      p = (countBits(board[n].p1) > countBits(board[n].p2) ? TTT_P2 : TTT_P1);
+
+    winner[n] = evalBoard(board[n].p1, board[n].p2, p, sets);
+    if (winner[n] != TTT_P0 || empty == 0)
+      move[n] = 0xff;
+    else
+      move[n] = selectMove(sets, empty, NULL);
+  }
+}
@@ -0,0 +1,102 @@
+// MD_TTT opening book and endgame table - 16 opening and 465 endgame boards
+//
+// Generated by tools/MD_TTT_BookGen.cpp - DO NOT EDIT.
+// See the generator for a description of the book format.
+//
+#include <MD_TTT.h>
+
+#if TTT_USE_BOOK
+
+extern const uint16_t TTT_bookSize = 481;
+
+extern const uint16_t TTT_bookKey[481] PROGMEM =
+{
+      0,     2,     5,     6,     7,    11,    33,    45,    63,    83,    87,   152,
+    158,   160,   162,   163,   165,   206,   212,   214,   230,   232,   238,   297,
+    314,   320,   322,   386,   395,   398,   401,   402,   403,   440,   449,   452,
+    455,   464,   466,   470,   473,   474,   475,   478,   480,   481,   554,   556,
+    626,   628,   632,   635,   637,   747,   800,   806,   808,   884,   887,   888,
+    889,   908,   914,   916,   935,   938,   941,   942,   960,   961,   964,   966,
+    967,  1034,  1043,  1046,  1049,  1050,  1051,  1115,  1127,  1131,  1142,  1151,
+   1154,  1157,  1158,  1159,  1169,  1181,  1185,  1190,  1193,  1194,  1195,  1199,
+   1203,  1205,  1206,  1207,  1209,  1211,  1213,  1232,  1238,  1240,  1250,  1259,
+   1262,  1265,  1266,  1274,  1276,  1280,  1283,  1284,  1285,  1288,  1290,  1291,
+   1304,  1316,  1319,  1320,  1321,  1331,  1343,  1347,  1352,  1355,  1356,  1357,
+   1368,  1369,  1371,  1373,  1375,  1382,  1384,  1388,  1391,  1392,  1393,  1396,
+   1399,  1406,  1409,  1410,  1415,  1419,  1421,  1422,  1425,  1427,  1508,  1510,
+   1562,  1564,  1589,  1590,  1591,  1718,  1724,  1726,  1736,  1745,  1748,  1751,
+   1752,  1753,  1762,  1770,  1771,  1774,  1776,  1777,  1790,  1799,  1802,  1805,
+   1806,  1807,  1842,  1843,  1851,  1854,  1855,  1857,  1861,  1868,  1870,  1874,
+   1877,  1878,  1879,  1892,  1895,  1896,  1897,  1901,  1905,  1907,  1920,  1921,
+   1927,  1929,  1933,  1958,  1960,  1966,  1976,  1978,  1982,  1985,  1986,  1987,
+   1990,  1992,  1993,  2002,  2008,  2010,  2030,  2032,  2036,  2039,  2040,  2041,
+   2044,  2047,  2054,  2057,  2058,  2059,  2063,  2067,  2069,  2071,  2073,  2075,
+   2077,  2082,  2083,  2089,  2091,  2095,  2101,  2110,  2116,  2136,  2137,  2143,
+   2145,  2147,  2149,  2492,  2501,  2504,  2507,  2508,  2509,  2573,  2585,  2589,
+   2627,  2639,  2652,  2653,  2657,  2661,  2663,  2665,  2667,  2669,  2671,  2732,
+   2734,  2738,  2741,  2743,  2814,  2815,  2819,  2825,  3233,  3237,  3341,  3392,
+   3395,  3398,  3399,  3400,  3410,  3419,  3422,  3425,  3427,  3437,  3449,  3453,
+   3461,  3462,  3463,  3467,  3471,  3473,  3475,  3477,  3479,  3481,  3491,  3503,
+   3543,  3545,  3557,  3561,  3562,  3569,  3571,  3575,  3581,  3583,  3587,  3589,
+   3597,  3599,  3608,  3611,  3614,  3615,  3908,  3911,  3913,  3939,  3967,  3989,
+   4047,  4048,  4136,  4138,  4142,  4145,  4147,  4150,  4153,  4163,  4164,  4165,
+   4169,  4173,  4175,  4177,  4181,  4183,  4195,  4201,  4207,  4219,  4223,  4229,
+   4231,  4237,  4245,  4247,  4256,  4259,  4263,  4264,  4273,  4281,  4282,  4285,
+   4303,  4307,  4309,  4325,  4327,  4331,  4334,  4335,  4336,  4924,  5005,  5009,
+   5011,  5600,  5603,  5605,  5608,  5611,  5633,  5639,  5659,  5665,  5689,  5693,
+   5695,  5717,  5720,  5743,  5746,  5761,  5765,  5773,  5792,  6367,  6421,  6448,
+   7361,  7364,  7367,  7369,  7445,  7469,  7472,  7475,  7499,  7523,  7525,  7529,
+   7531,  7607,  7769,  7772,  7774,  7841,  7847,  7853,  7931,  7934,  8042,  8044,
+   8069,  8071,  8120,  8123,  8282,  8285,  8287,  8309,  8335,  8341,  8363,  8516,
+   8519,  8521,  8543,  8549,  8555,  8557,  8575,  8581,  8597,  8603,  8609,  8630,
+   8633,  8636,  8681,  8683,  8705,  8708,  8710, 10469, 10528, 10709, 10715, 10736,
+  10739, 10742, 10744, 10762, 10768, 10790, 10793, 10820, 10868, 12220, 14711, 14873,
+  17060
+};
+
+extern const uint16_t TTT_bookMoves[481] PROGMEM =
+{
+  0x145, 0x010, 0x010, 0x005, 0x058, 0x160, 0x011, 0x001, 0x111, 0x0ee, 0x16d, 0x040,
+  0x080, 0x100, 0x145, 0x04e, 0x005, 0x120, 0x1e0, 0x040, 0x120, 0x120, 0x1e0, 0x104,
+  0x100, 0x040, 0x010, 0x044, 0x140, 0x082, 0x080, 0x001, 0x100, 0x104, 0x100, 0x1c2,
+  0x1c0, 0x104, 0x080, 0x100, 0x100, 0x100, 0x100, 0x040, 0x040, 0x040, 0x050, 0x010,
+  0x080, 0x100, 0x040, 0x0c0, 0x140, 0x101, 0x010, 0x080, 0x100, 0x002, 0x080, 0x001,
+  0x100, 0x180, 0x100, 0x008, 0x180, 0x180, 0x100, 0x001, 0x1a0, 0x1a0, 0x020, 0x020,
+  0x020, 0x004, 0x110, 0x002, 0x080, 0x001, 0x100, 0x004, 0x002, 0x001, 0x184, 0x100,
+  0x180, 0x100, 0x189, 0x008, 0x184, 0x182, 0x001, 0x100, 0x100, 0x080, 0x080, 0x100,
+  0x100, 0x100, 0x180, 0x180, 0x180, 0x100, 0x080, 0x010, 0x100, 0x008, 0x004, 0x010,
+  0x180, 0x100, 0x001, 0x010, 0x010, 0x010, 0x010, 0x010, 0x010, 0x110, 0x190, 0x110,
+  0x004, 0x182, 0x080, 0x101, 0x108, 0x004, 0x182, 0x001, 0x004, 0x084, 0x004, 0x104,
+  0x100, 0x100, 0x080, 0x080, 0x100, 0x180, 0x008, 0x180, 0x188, 0x189, 0x008, 0x008,
+  0x008, 0x100, 0x100, 0x001, 0x100, 0x001, 0x180, 0x001, 0x001, 0x100, 0x010, 0x010,
+  0x080, 0x100, 0x0a0, 0x020, 0x120, 0x100, 0x018, 0x010, 0x010, 0x110, 0x010, 0x010,
+  0x010, 0x010, 0x100, 0x100, 0x100, 0x010, 0x090, 0x010, 0x008, 0x108, 0x008, 0x088,
+  0x008, 0x108, 0x001, 0x100, 0x100, 0x001, 0x100, 0x080, 0x100, 0x104, 0x104, 0x100,
+  0x100, 0x100, 0x100, 0x104, 0x104, 0x104, 0x184, 0x100, 0x100, 0x100, 0x005, 0x004,
+  0x102, 0x101, 0x100, 0x008, 0x010, 0x110, 0x010, 0x110, 0x190, 0x090, 0x190, 0x110,
+  0x110, 0x090, 0x110, 0x004, 0x002, 0x001, 0x080, 0x100, 0x008, 0x080, 0x101, 0x100,
+  0x100, 0x180, 0x082, 0x080, 0x100, 0x100, 0x082, 0x101, 0x180, 0x100, 0x080, 0x080,
+  0x100, 0x080, 0x184, 0x102, 0x081, 0x100, 0x180, 0x004, 0x002, 0x004, 0x004, 0x002,
+  0x001, 0x100, 0x080, 0x144, 0x100, 0x152, 0x010, 0x001, 0x100, 0x044, 0x002, 0x001,
+  0x104, 0x142, 0x100, 0x100, 0x100, 0x100, 0x100, 0x040, 0x040, 0x140, 0x040, 0x010,
+  0x010, 0x050, 0x010, 0x010, 0x140, 0x100, 0x042, 0x040, 0x100, 0x100, 0x100, 0x100,
+  0x100, 0x100, 0x100, 0x100, 0x100, 0x110, 0x100, 0x110, 0x108, 0x100, 0x100, 0x101,
+  0x110, 0x100, 0x100, 0x110, 0x110, 0x110, 0x100, 0x110, 0x110, 0x100, 0x104, 0x102,
+  0x104, 0x104, 0x102, 0x100, 0x100, 0x100, 0x108, 0x100, 0x100, 0x108, 0x100, 0x108,
+  0x101, 0x100, 0x100, 0x100, 0x100, 0x101, 0x01a, 0x010, 0x010, 0x010, 0x010, 0x00a,
+  0x001, 0x100, 0x010, 0x010, 0x008, 0x010, 0x110, 0x110, 0x010, 0x010, 0x004, 0x110,
+  0x012, 0x111, 0x110, 0x110, 0x010, 0x110, 0x002, 0x010, 0x010, 0x100, 0x002, 0x008,
+  0x102, 0x100, 0x101, 0x004, 0x100, 0x002, 0x101, 0x100, 0x100, 0x001, 0x100, 0x102,
+  0x002, 0x108, 0x008, 0x104, 0x004, 0x100, 0x100, 0x101, 0x100, 0x002, 0x142, 0x040,
+  0x140, 0x010, 0x010, 0x018, 0x008, 0x008, 0x010, 0x100, 0x010, 0x110, 0x108, 0x100,
+  0x108, 0x102, 0x100, 0x100, 0x100, 0x00a, 0x108, 0x008, 0x100, 0x110, 0x100, 0x100,
+  0x0b0, 0x080, 0x080, 0x090, 0x080, 0x0a0, 0x080, 0x080, 0x080, 0x0a0, 0x080, 0x080,
+  0x080, 0x080, 0x080, 0x080, 0x080, 0x090, 0x090, 0x080, 0x080, 0x080, 0x090, 0x010,
+  0x010, 0x010, 0x0aa, 0x080, 0x018, 0x018, 0x010, 0x010, 0x010, 0x010, 0x008, 0x008,
+  0x008, 0x010, 0x092, 0x090, 0x010, 0x010, 0x010, 0x010, 0x008, 0x008, 0x080, 0x080,
+  0x002, 0x080, 0x008, 0x088, 0x082, 0x080, 0x080, 0x01a, 0x010, 0x008, 0x010, 0x010,
+  0x012, 0x010, 0x010, 0x010, 0x010, 0x008, 0x002, 0x002, 0x008, 0x010, 0x0a0, 0x010,
+  0x010
+};
+
+#endif
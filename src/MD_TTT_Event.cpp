@@ -0,0 +1,174 @@
+/*
+  MD_TTT_Event.cpp - Arduino library for TicTacToe game decision engine
+  Copyright (C) 2013 Marco Colli
+  All rights reserved.
+
+  Game event queue, the alternative to the move callback.
+
+  See MD_TTT.h for complete comments
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <MD_TTT.h>
+#include "MD_TTT_lib.h"
+
+// Encoded event - bits 6-7 the type, bits 4-5 the player and bits 0-3
+// the cell or winning line.
+#define EVT_TYPE_SHIFT    6
+#define EVT_PLAYER_SHIFT  4
+#define EVT_POS     0x0f  ///< the cell or line, EVT_POS if none
+#define EVT_NONE    0xff  ///< no event pushed yet, or the last one was dropped
+#define EVT_RESUME  TTT_EVT_SYNC  ///< queued type for TTT_EVT_RESUME, as TTT_EVT_SYNC is never queued
+
+#define EVT_ENCODE(t, p, c) ((uint8_t)(((t) << EVT_TYPE_SHIFT) | (((p) == TTT_P1 ? 1 : ((p) == TTT_P2 ? 2 : 0)) << EVT_PLAYER_SHIFT) | ((c) & EVT_POS)))
+
+#if TTT_USE_EVENTS
+bool MD_TTT::setEventQueue(uint8_t *buf, uint8_t size)
+{
+  uint8_t n = 128;
+
+  if (buf == NULL)
+  {
+    _evtQueue = NULL;
+    return(true);
+  }
+  if (size < 2)
+    return(false);
+
+  // round down to a power of 2
+  while (n > size)
+    n >>= 1;
+
+  _evtMask = n - 1;
+  _evtHead = 0;
+  _evtTail = 0;
+  _evtLost = _evtSeen = 0;
+  _evtLast = EVT_NONE;
+  _evtQueue = buf;
+
+  return(true);
+}
+
+void MD_TTT::pushEvent(uint8_t evt)
+// Producer side of the ring buffer. The indices run freely and are 
+// masked to address the queue, so head - tail is the number of events 
+// waiting. The event must be in the queue before the new head is seen.
+// A dropped event is not the last one queued, so nothing coalesces with it.
+{
+  uint8_t head = _evtHead;
+
+  if ((uint8_t)(head - EVT_LOAD(_evtTail)) > _evtMask)
+  {
+    _evtLast = EVT_NONE;
+    EVT_STORE(_evtLost, (uint8_t)(_evtLost + 1));
+    return;
+  }
+
+  _evtLast = evt;
+  _evtQueue[head & _evtMask] = evt;
+  EVT_STORE(_evtHead, (uint8_t)(head + 1));
+}
+
+bool MD_TTT::getEvent(tttEvent *pEvent)
+// Consumer side of the ring buffer. The event must be read before the
+// new tail frees its slot.
+{
+  uint8_t tail = _evtTail;
+  uint8_t lost, evt;
+
+  if (_evtQueue == NULL || pEvent == NULL)
+    return(false);
+
+  // after lost events the rest are of no use, the board is drawn again
+  lost = EVT_LOAD(_evtLost);
+  if (lost != _evtSeen)
+  {
+    _evtSeen = lost;
+    EVT_STORE(_evtTail, EVT_LOAD(_evtHead));
+    pEvent->type = TTT_EVT_SYNC;
+    pEvent->pos = 0xff;
+    pEvent->player = TTT_P0;
+    return(true);
+  }
+
+  if (tail == EVT_LOAD(_evtHead))
+    return(false);
+
+  evt = _evtQueue[tail & _evtMask];
+  EVT_STORE(_evtTail, (uint8_t)(tail + 1));
+
+  pEvent->type = evt >> EVT_TYPE_SHIFT;
+  if (pEvent->type == EVT_RESUME)
+    pEvent->type = TTT_EVT_RESUME;
+  pEvent->pos = ((evt & EVT_POS) == EVT_POS ? 0xff : evt & EVT_POS);
+  switch ((evt >> EVT_PLAYER_SHIFT) & 0x3)
+  {
+  case 1:  pEvent->player = TTT_P1; break;
+  case 2:  pEvent->player = TTT_P2; break;
+  default: pEvent->player = TTT_P0; break;
+  }
+
+  return(true);
+}
+#endif
+
+void MD_TTT::notifyCell(uint8_t pos, int8_t player)
+{
+#if TTT_USE_EVENTS
+  if (_evtQueue != NULL)
+    pushEvent(EVT_ENCODE(TTT_EVT_CELL, player, pos));
+  else
+#endif
+  if (_cbMoveHandler != NULL)
+    (_cbMoveHandler)(pos, player);
+}
+
+void MD_TTT::notifyClear(void)
+// A queue gets one event, coalesced with the last one if that was also
+// a clear. The callback is run for each cell to sync the user board.
+{
+#if TTT_USE_EVENTS
+  if (_evtQueue != NULL)
+  {
+    if (_evtLast != EVT_ENCODE(TTT_EVT_CLEAR, TTT_P0, EVT_POS))
+      pushEvent(EVT_ENCODE(TTT_EVT_CLEAR, TTT_P0, EVT_POS));
+  }
+  else
+#endif
+  if (_cbMoveHandler != NULL)
+  {
+    for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+      (_cbMoveHandler)(i, TTT_P0);
+  }
+}
+
+void MD_TTT::notifyOver(void)
+// Only a queue is told, the callback checks isGameOver() itself.
+{
+#if TTT_USE_EVENTS
+  if (_evtQueue != NULL && _gameOver)
+    pushEvent(EVT_ENCODE(TTT_EVT_OVER, _gameWinner, _winLine));
+#endif
+}
+
+void MD_TTT::notifyResume(void)
+// Only a queue is told, as for notifyOver().
+{
+#if TTT_USE_EVENTS
+  if (_evtQueue != NULL && !_gameOver)
+    pushEvent(EVT_ENCODE(EVT_RESUME, TTT_P0, EVT_POS));
+#endif
+}
@@ -0,0 +1,66 @@
+/*
+  MD_TTT_HAL.h - Arduino library for TicTacToe game decision engine
+  Copyright (C) 2013 Marco Colli
+  All rights reserved.
+
+  Hardware abstraction for building the library on a host computer
+  without the Arduino core, for example to test or profile the game
+  engine. It supplies just the Arduino definitions used by the library.
+  MD_TTT.h includes this file instead of Arduino.h when ARDUINO is
+  not defined.
+
+  See MD_TTT.h for complete comments
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#ifndef _MD_TTT_HAL_H
+#define _MD_TTT_HAL_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+
+// Program memory is normal memory on the host
+#define PROGMEM
+#define pgm_read_byte(p)  (*(const uint8_t *)(p))
+#define pgm_read_word(p)  (*(const uint16_t *)(p))
+#define pgm_read_dword(p) (*(const uint32_t *)(p))
+
+// Time
+inline unsigned long micros(void)
+// microseconds since the first call, wrapping like the Arduino function
+{
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  return((unsigned long)std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+inline uint64_t halNanos(void)
+// nanoseconds from an arbitrary start, for timing short intervals
+{
+  return((uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+// Debug output, in place of Serial.print()
+inline void halPrint(const char *s) { fputs(s, stdout); }
+inline void halPrint(char c) { putchar(c); }
+inline void halPrint(int v) { printf("%d", v); }
+inline void halPrint(unsigned int v) { printf("%u", v); }
+inline void halPrint(long v) { printf("%ld", v); }
+inline void halPrint(unsigned long v) { printf("%lu", v); }
+
+#endif
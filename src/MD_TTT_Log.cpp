@@ -0,0 +1,137 @@
+/*
+  MD_TTT_Log.cpp - Arduino library for TicTacToe game decision engine
+  Copyright (C) 2013 Marco Colli
+  All rights reserved.
+
+  Move log writing and fast replay.
+
+  See MD_TTT.h for complete comments
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <MD_TTT.h>
+#include "MD_TTT_lib.h"
+
+// Move log record header
+#define LOG_MOVES     0x0f  ///< byte 0, the number of moves
+#define LOG_FIRST_P2  0x10  ///< byte 0, TTT_P2 moved first
+#define LOG_VERSION   0xe0  ///< byte 0, the format version (0)
+#define LOG_AUTO      0x03  ///< byte 1, the auto player
+#define LOG_ENGINE    0x0c  ///< byte 1, the auto player engine
+
+#if TTT_USE_UNDO
+uint8_t MD_TTT::writeLog(uint8_t *buf, uint8_t size)
+{
+  uint8_t moves = TTT_BOARD_SIZE - _movesLeft;
+  uint8_t len = TTT_LOG_HEADER + (moves + 1) / 2;
+  uint8_t first = (moves > 0 ? (_moveStack[0] & MOVE_P2) : 0);
+
+  if (buf == NULL || size < len)
+    return(0);
+
+  // the players must take turns as only the cells are recorded
+  for (uint8_t i=0; i<moves; i++)
+    if (((_moveStack[i] & MOVE_P2) != 0) != ((first != 0) != ((i & 1) != 0)))
+      return(0);
+
+  buf[0] = moves | (first ? LOG_FIRST_P2 : 0);
+  buf[1] = (_autoPlayer == TTT_P1 ? 1 : (_autoPlayer == TTT_P2 ? 2 : 0)) | ((_autoEngine << 2) & LOG_ENGINE);
+  for (uint8_t i=0; i<4; i++)
+    buf[2+i] = (_startRandom >> (8 * i)) & 0xff;
+
+  for (uint8_t i=0; i<moves; i++)
+  {
+    uint8_t cell = _moveStack[i] & MOVE_CELL;
+
+    if (i & 1)
+      buf[TTT_LOG_HEADER + i/2] |= cell << 4;
+    else
+      buf[TTT_LOG_HEADER + i/2] = cell;
+  }
+
+  return(len);
+}
+#endif
+
+uint32_t MD_TTT::replayLog(const uint8_t *log, uint32_t size, tttGameResult *result, uint32_t count)
+// Replay each game on bitboards, only checking the lines through the 
+// cell of each move for a win.
+{
+  uint32_t games = 0;
+
+  while (size >= TTT_LOG_HEADER)
+  {
+    tttGameResult r;
+    uint16_t board[2] = { 0, 0 };  // [0] is the player to move
+    int8_t   player = (log[0] & LOG_FIRST_P2) ? TTT_P2 : TTT_P1;
+
+    r.moves = log[0] & LOG_MOVES;
+    r.length = TTT_LOG_HEADER + (r.moves + 1) / 2;
+    if ((log[0] & LOG_VERSION) != 0 || r.moves > TTT_BOARD_SIZE || r.length > size)
+      break;    // damaged record, so the rest of the log cannot be found
+
+    r.autoPlayer = ((log[1] & LOG_AUTO) == 1 ? TTT_P1 : ((log[1] & LOG_AUTO) == 2 ? TTT_P2 : TTT_P0));
+    r.autoEngine = (log[1] & LOG_ENGINE) >> 2;
+    r.seed = log[2] | ((uint32_t)log[3] << 8) | ((uint32_t)log[4] << 16) | ((uint32_t)log[5] << 24);
+    r.valid = true;
+    r.gameOver = false;
+    r.winner = TTT_P0;
+    r.winLine = 0xff;
+
+    for (uint8_t i=0; i<r.moves && r.valid; i++)
+    {
+      uint8_t cell = (log[TTT_LOG_HEADER + i/2] >> ((i & 1) ? 4 : 0)) & 0xf;
+
+      // the cell must be on the board and empty, and the game not over
+      if (cell >= TTT_BOARD_SIZE || ((board[0] | board[1]) & CELL_MASK(cell)) || r.gameOver)
+      {
+        r.valid = false;
+        break;
+      }
+
+      uint8_t lines = pgm_read_byte(&TTT_wwm[cell]);
+
+      board[0] |= CELL_MASK(cell);
+      for (uint8_t l=0, mask=0x80; l<TTT_WIN_LINES; l++, mask>>=1)
+      {
+        if (!(lines & mask))
+          continue;
+
+        uint16_t cells = pgm_read_word(&TTT_wlm[l]);
+
+        if ((board[0] & cells) == cells)
+        {
+          r.gameOver = true;
+          r.winner = player;
+          r.winLine = l;
+        }
+      }
+      r.gameOver |= (i == TTT_BOARD_SIZE - 1);
+
+      // next player's turn
+      uint16_t t = board[0]; board[0] = board[1]; board[1] = t;
+      player = -player;
+    }
+
+    if (result != NULL && games < count)
+      result[games] = r;
+    games++;
+    log += r.length;
+    size -= r.length;
+  }
+
+  return(games);
+}
@@ -0,0 +1,598 @@
+/*
+  MD_TTT_MNK.h - Arduino library for TicTacToe game decision engine
+  Copyright (C) 2013 Marco Colli
+  All rights reserved.
+
+  Game engine for m,n,k games (k in a row on an m x n board).
+
+  See MD_TTT.h for complete comments
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#ifndef _MD_TTT_MNK_H
+#define _MD_TTT_MNK_H
+
+#include <MD_TTT.h>
+
+/**
+ * Compile time type selection.
+ *
+ * type is T if B is true, otherwise F. This is the same as
+ * std::conditional, which is not available for all Arduino targets.
+ */
+template <bool B, typename T, typename F> struct tttSelect { typedef T type; };
+template <typename T, typename F> struct tttSelect<false, T, F> { typedef F type; };
+
+/**
+ * Compile time index sequence.
+ *
+ * tttMakeSeq<N>::type is tttSeq<0, 1, ... N-1>, as std::make_index_sequence
+ * in C++14. It is built by halves so the template depth stays small for
+ * large N.
+ */
+template <uint16_t... I> struct tttSeq {};
+template <typename A, typename B> struct tttSeqCat;
+template <uint16_t... I, uint16_t... J> struct tttSeqCat<tttSeq<I...>, tttSeq<J...> >
+  { typedef tttSeq<I..., (uint16_t)(sizeof...(I) + J)...> type; };
+template <uint16_t N> struct tttMakeSeq
+  { typedef typename tttSeqCat<typename tttMakeSeq<N / 2>::type, typename tttMakeSeq<N - N / 2>::type>::type type; };
+template <> struct tttMakeSeq<0> { typedef tttSeq<> type; };
+template <> struct tttMakeSeq<1> { typedef tttSeq<0> type; };
+
+/**
+ * Table of the lines through each cell of an m,n,k game.
+ *
+ * The table is filled in by the compiler from G::cellLineInit(), which 
+ * gives CELL_LINES entries for each cell ending in NO_LINE, and kept in 
+ * program memory, as for the MD_TTT game tables.
+ */
+template <class G, typename S> struct tttCellLineTable;
+template <class G, uint16_t... I> struct tttCellLineTable<G, tttSeq<I...> >
+{
+  static const typename G::line_t table[sizeof...(I)]; ///< CELL_LINES entries for each cell
+};
+
+template <class G, uint16_t... I>
+const typename G::line_t tttCellLineTable<G, tttSeq<I...> >::table[sizeof...(I)] PROGMEM = { G::cellLineInit(I)... };
+
+/**
+ * Bitboard for N cells.
+ *
+ * Held in the narrowest unsigned integer that fits N bits, or in an
+ * array of 32 bit words for more than 32 cells.
+ */
+template <uint16_t N>
+class tttBits
+{
+  public:
+  typedef typename tttSelect<(N <= 8), uint8_t,
+          typename tttSelect<(N <= 16), uint16_t, uint32_t>::type>::type word_t; ///< storage word type
+
+  static const uint8_t  WORD_BITS = 8 * sizeof(word_t);                 ///< bits in each word
+  static const uint16_t WORDS = (N + WORD_BITS - 1) / WORD_BITS;        ///< words in the bitboard
+
+  void clear(void) { for (uint16_t i=0; i<WORDS; i++) _w[i] = 0; }      ///< clear all the bits
+  bool test(uint16_t i) const { return((_w[i / WORD_BITS] >> (i % WORD_BITS)) & 1); } ///< test bit i
+  void set(uint16_t i) { _w[i / WORD_BITS] |= ((word_t)1 << (i % WORD_BITS)); }      ///< set bit i
+  void reset(uint16_t i) { _w[i / WORD_BITS] &= ~((word_t)1 << (i % WORD_BITS)); }   ///< clear bit i
+
+  private:
+  word_t _w[WORDS];
+};
+
+/**
+ * Game engine for m,n,k games.
+ *
+ * The players take turns placing their token on a board with Rows x Cols
+ * cells, and the first player with K tokens in a row, column or diagonal
+ * wins. The classic TicTacToe game is <3, 3, 3>, for which the MD_TTT class
+ * remains the smaller and faster choice. Typical larger games are <4, 4, 4>
+ * or Gomoku <15, 15, 5>.
+ *
+ * Which cells are in each line, and which lines pass through each cell,
+ * are constexpr functions of the board geometry. The compiler uses them to
+ * fill in a table of the lines through each cell for the board size, kept
+ * in program memory, which the moves and the search read. The integer
+ * types used for cells, lines and bitboards are chosen at compile time as
+ * the narrowest that fit the board.
+ *
+ * Cells are numbered from 0 at the top left, row by row, and the public
+ * interface follows MD_TTT. Players are TTT_P1 and TTT_P2.
+ *
+ * The auto player searches the game tree with negamax and alpha-beta
+ * pruning, to a depth set with setSearchDepth(). The boards are scored from
+ * the number of tokens each player has in each line that is still open,
+ * kept up to date as each move is made and unmade. To let the search scale
+ * to larger boards, on boards with more than 16 cells only the empty cells
+ * next to a token are considered, and only the most promising of those
+ * (by the same line scores) are searched at each node.
+ *
+ * \tparam Rows  number of rows on the board.
+ * \tparam Cols  number of columns on the board.
+ * \tparam K     number in a row needed to win.
+ */
+template <uint8_t Rows, uint8_t Cols, uint8_t K>
+class MD_TTT_MNK
+{
+  template <class G, typename S> friend struct tttCellLineTable;
+
+  static_assert((K >= 2) && (K <= Rows) && (K <= Cols), "K must be in the range [2..min(Rows, Cols)]");
+  static_assert(K <= 10, "K must be 10 or less for the line scores");
+  static_assert(Rows * Cols < 255, "Board can have up to 254 cells");
+
+  public:
+  typedef uint8_t cell_t;   ///< type for a cell number
+  static const cell_t BOARD_SIZE = Rows * Cols;   ///< number of cells on the board
+
+  static const uint16_t H_LINES = Rows * (Cols - K + 1);        ///< number of horizontal lines
+  static const uint16_t V_LINES = (Rows - K + 1) * Cols;        ///< number of vertical lines
+  static const uint16_t D_LINES = (Rows - K + 1) * (Cols - K + 1); ///< number of lines for each diagonal direction
+  static const uint16_t WIN_LINES = H_LINES + V_LINES + 2 * D_LINES; ///< total number of winning lines
+
+  typedef typename tttSelect<(WIN_LINES < 255), uint8_t, uint16_t>::type line_t; ///< type for a line number
+  static const line_t NO_LINE = (line_t)-1;   ///< not a line
+  static const uint8_t CELL_LINES = 4 * K;    ///< most lines through a cell, K in each direction
+
+  /**
+   * Class Constructor.
+   *
+   * As for MD_TTT, mh is a callback function invoked as each cell on
+   * the board changes, or NULL if not needed.
+   *
+   * \param mh pointer to user callback function.
+   */
+  MD_TTT_MNK(void (*mh)(cell_t pos, int8_t player)) :
+    _autoPlayer(TTT_P0), _depth(BOARD_SIZE <= 9 ? BOARD_SIZE : (BOARD_SIZE <= 16 ? 6 : 4)), _nodes(0), _cbMoveHandler(mh)
+    {}
+
+  /**
+   * Reset the board for a new game.
+   *
+   * \return true if no errors occurred, false otherwise.
+   */
+  bool start(void)
+  {
+    _board[0].clear();
+    _board[1].clear();
+    for (line_t l=0; l<WIN_LINES; l++)
+      _count[0][l] = _count[1][l] = 0;
+    _score = 0;
+    _movesLeft = BOARD_SIZE;
+    _gameOver = false;
+    _gameWinner = TTT_P0;
+    _winLine = NO_LINE;
+
+    if (_cbMoveHandler != NULL)
+      for (cell_t i=0; i<BOARD_SIZE; i++)
+        (_cbMoveHandler)(i, TTT_P0);
+
+    return(true);
+  }
+
+  /**
+   * Execute the next game move.
+   *
+   * As for MD_TTT::doMove(), if player is the auto player then pos
+   * is ignored and the library works out the move.
+   *
+   * \param pos position on the board for the move [0..BOARD_SIZE-1].
+   * \param player  player identifier TT_P1 or TT_P2.
+   * \return true if no errors occurred, false otherwise.
+   */
+  bool doMove(cell_t pos, int8_t player)
+  {
+    line_t line;
+
+    if ((player != TTT_P1) && (player != TTT_P2)) return(false);
+    if (_gameOver) return(false);
+    if (player == _autoPlayer)
+      pos = searchMove(player);
+
+    if (pos >= BOARD_SIZE) return(false);
+    if (_board[0].test(pos) || _board[1].test(pos)) return(false);
+
+    line = makeMove(pos, player);
+    if (line != NO_LINE)
+    {
+      _gameOver = true;
+      _gameWinner = player;
+      _winLine = line;
+    }
+    _gameOver |= (_movesLeft == 0);
+
+    if (_cbMoveHandler != NULL)
+      (_cbMoveHandler)(pos, player);
+
+    return(true);
+  }
+
+  /**
+   * Set the computer player.
+   *
+   * \param player  player identifier TT_P0, TT_P1 or TT_P2.
+   * \return true if no errors occurred, false otherwise.
+   */
+  bool setAutoPlayer(int8_t player)
+  {
+    if ((player != TTT_P0) && (player != TTT_P1) && (player != TTT_P2))
+      return(false);
+    _autoPlayer = player;
+    return(true);
+  }
+
+  /**
+   * Get the computer player id.
+   *
+   * \return the player identifier, one of TTT_P*.
+   */
+  int8_t getAutoPlayer(void) { return(_autoPlayer); }
+
+  /**
+   * Set the search depth.
+   *
+   * Sets the number of moves ahead searched by the auto player. The
+   * default is the whole game for boards up to 9 cells, 6 moves for
+   * boards up to 16 cells and 4 moves for larger boards. The time taken
+   * grows quickly with the depth, especially on small processors.
+   *
+   * \param depth number of moves to search [1..BOARD_SIZE].
+   */
+  void setSearchDepth(uint8_t depth) { _depth = (depth == 0 ? 1 : depth); }
+
+  /**
+   * Get the search node count.
+   *
+   * \return the number of nodes examined by the last auto player move.
+   */
+  uint32_t getSearchNodes(void) { return(_nodes); }
+
+  /**
+   * Return if the game is over
+   *
+   * \return true if the game is over, false otherwise.
+   */
+  bool isGameOver(void) { return(_gameOver); }
+
+  /**
+   * Return the player that won
+   *
+   * \return winner player identifier, one of TTT_P*.
+   */
+  int8_t getGameWinner(void) { return(_gameWinner); }
+
+  /**
+   * Return the winning line
+   *
+   * The line number can be converted to cells using lineCell().
+   *
+   * \return the winning line number, or NO_LINE.
+   */
+  line_t getWinLine(void) { return(_winLine); }
+
+  /**
+   * Get the occupier of a board position
+   *
+   * \param pos the position to check
+   * \return the player identifier, one of TTT_P*.
+   */
+  int8_t getBoardPosition(cell_t pos)
+  {
+    if (pos >= BOARD_SIZE) return(TTT_P0);
+    if (_board[0].test(pos)) return(TTT_P1);
+    if (_board[1].test(pos)) return(TTT_P2);
+    return(TTT_P0);
+  }
+
+  //--------------------------------------------------------------
+  // Board geometry, all evaluated at compile time for constant arguments
+
+  /**
+   * Get a cell in a line
+   *
+   * \param line the line number [0..WIN_LINES-1].
+   * \param j    the position in the line [0..K-1].
+   * \return the cell number.
+   */
+  static constexpr cell_t lineCell(line_t line, uint8_t j)
+  {
+    return(lineStart(line) + j * lineStep(line));
+  }
+
+  /**
+   * Check if a cell is in a line
+   *
+   * This is the win line incidence matrix for the board.
+   *
+   * \param pos  the cell number.
+   * \param line the line number.
+   * \return true if the cell is part of the line.
+   */
+  static constexpr bool inLine(cell_t pos, line_t line)
+  {
+    return(pos >= lineStart(line) && (pos - lineStart(line)) % lineStep(line) == 0 &&
+           (pos - lineStart(line)) / lineStep(line) < K &&
+           // the line must not wrap around the board edge
+           colOf(pos) == colOf(lineStart(line)) + ((pos - lineStart(line)) / lineStep(line)) * lineDCol(line));
+  }
+
+  protected:
+  // line directions, in the order of the line numbers
+  enum { DIR_H = 0, DIR_V = 1, DIR_D = 2, DIR_A = 3 };
+
+  // Scores. A win must be worth more than any sum of line scores. The 
+  // board score is at most WIN_LINES lines of K-1 tokens, and the move 
+  // ordering key for a cell at most CELL_LINES lines of K tokens, counted 
+  // 3 times for attack and defence. Where either does not fit below 
+  // SCORE_WIN in 32 bits the scores are 64 bit.
+  static const uint64_t SCORE_BOARD_MAX = (uint64_t)WIN_LINES << (3 * (K - 2));
+  static const uint64_t SCORE_KEY_MAX = (uint64_t)3 * CELL_LINES << (3 * (K - 1));
+  static const uint64_t SCORE_MAX = (SCORE_BOARD_MAX > SCORE_KEY_MAX ? SCORE_BOARD_MAX : SCORE_KEY_MAX);
+
+  typedef typename tttSelect<(SCORE_MAX < 0x20000000UL), int32_t, int64_t>::type score_t; ///< type for a score
+
+  static const score_t SCORE_WIN = (score_t)1 << (sizeof(score_t) == 4 ? 29 : 61);
+  static const score_t SCORE_INF = 2 * SCORE_WIN;
+
+  static_assert(SCORE_MAX < (uint64_t)SCORE_WIN, "Line scores must always be less than a win");
+
+  // Most moves searched at each node on large boards
+  static const uint8_t BRANCH = (BOARD_SIZE <= 16 ? BOARD_SIZE : 12);
+
+  static constexpr uint8_t rowOf(cell_t pos) { return(pos / Cols); }
+  static constexpr int16_t colOf(cell_t pos) { return(pos % Cols); }
+  static constexpr uint8_t lineDir(line_t l)
+  {
+    return(l < H_LINES ? DIR_H : l < H_LINES + V_LINES ? DIR_V : l < H_LINES + V_LINES + D_LINES ? DIR_D : DIR_A);
+  }
+  static constexpr int8_t lineDCol(line_t l)
+  {
+    return(lineDir(l) == DIR_H ? 1 : lineDir(l) == DIR_V ? 0 : lineDir(l) == DIR_D ? 1 : -1);
+  }
+  static constexpr uint8_t lineStep(line_t l)
+  {
+    return(lineDir(l) == DIR_H ? 1 : lineDir(l) == DIR_V ? Cols : lineDir(l) == DIR_D ? Cols + 1 : Cols - 1);
+  }
+  static constexpr cell_t lineStart(line_t l)
+  {
+    return(lineDir(l) == DIR_H ? (l / (Cols - K + 1)) * Cols + (l % (Cols - K + 1)) :
+           lineDir(l) == DIR_V ? (l - H_LINES) :
+           lineDir(l) == DIR_D ? ((l - H_LINES - V_LINES) / (Cols - K + 1)) * Cols + ((l - H_LINES - V_LINES) % (Cols - K + 1)) :
+           ((l - H_LINES - V_LINES - D_LINES) / (Cols - K + 1)) * Cols + ((l - H_LINES - V_LINES - D_LINES) % (Cols - K + 1)) + K - 1);
+  }
+
+  static constexpr line_t lineThrough(uint8_t r, uint8_t c, uint8_t dir, uint8_t j)
+  // The line in direction dir that has cell (r, c) as its j'th cell,
+  // or NO_LINE if that line would fall off the board.
+  {
+    return(dir == DIR_H ? ((c >= j && c - j <= Cols - K) ?
+                           r * (Cols - K + 1) + (c - j) : NO_LINE) :
+           dir == DIR_V ? ((r >= j && r - j <= Rows - K) ?
+                           H_LINES + (r - j) * Cols + c : NO_LINE) :
+           dir == DIR_D ? ((r >= j && r - j <= Rows - K && c >= j && c - j <= Cols - K) ?
+                           H_LINES + V_LINES + (r - j) * (Cols - K + 1) + (c - j) : NO_LINE) :
+                          ((r >= j && r - j <= Rows - K && c + j >= K - 1 && c + j < Cols) ?
+                           H_LINES + V_LINES + D_LINES + (r - j) * (Cols - K + 1) + (c + j - (K - 1)) : NO_LINE));
+  }
+
+  static constexpr line_t nthLineThrough(uint8_t r, uint8_t c, uint8_t n, uint8_t s)
+  // The n'th line through cell (r, c) that is on the board, looking from 
+  // slot s of the CELL_LINES possible lines (K in each direction).
+  {
+    return(s == CELL_LINES ? NO_LINE :
+           lineThrough(r, c, s / K, s % K) == NO_LINE ? nthLineThrough(r, c, n, s + 1) :
+           n == 0 ? lineThrough(r, c, s / K, s % K) : nthLineThrough(r, c, n - 1, s + 1));
+  }
+
+  static constexpr line_t cellLineInit(uint16_t i)
+  // Entry i of the table of lines through each cell, the n'th line 
+  // through cell i / CELL_LINES where n is i % CELL_LINES
+  {
+    return(nthLineThrough(rowOf(i / CELL_LINES), colOf(i / CELL_LINES), i % CELL_LINES, 0));
+  }
+
+  static line_t cellLine(cell_t pos, uint8_t n)
+  // The n'th line through the cell from the table, or NO_LINE after the last
+  {
+    const line_t *p = &tttCellLineTable<MD_TTT_MNK, typename tttMakeSeq<BOARD_SIZE * CELL_LINES>::type>::table[pos * CELL_LINES + n];
+
+    return(sizeof(line_t) == 1 ? (line_t)pgm_read_byte(p) : (line_t)pgm_read_word(p));
+  }
+
+  static constexpr score_t tokenScore(uint8_t n)
+  // score for n tokens in an open line
+  {
+    return(n == 0 ? 0 : (score_t)1 << (3 * (n - 1)));
+  }
+
+  static constexpr score_t lineScore(uint8_t n1, uint8_t n2)
+  // score for a line from the point of view of TTT_P1, given the
+  // number of tokens of each player in the line
+  {
+    return((n2 == 0 ? tokenScore(n1) : 0) - (n1 == 0 ? tokenScore(n2) : 0));
+  }
+
+  tttBits<BOARD_SIZE> _board[2];    ///< cells occupied by TTT_P1 [0] and TTT_P2 [1]
+  uint8_t _count[2][WIN_LINES];     ///< tokens in each line for TTT_P1 [0] and TTT_P2 [1]
+  score_t _score;           ///< sum of the line scores from the point of view of TTT_P1
+  cell_t  _movesLeft;       ///< the number of moves left in the game
+  bool    _gameOver;        ///< flag to know when the game is over
+  int8_t  _gameWinner;      ///< id of player who won
+  line_t  _winLine;         ///< the winning line or NO_LINE
+  int8_t  _autoPlayer;      ///< the computer player (TTT_P0 if neither)
+  uint8_t _depth;           ///< search depth for the auto player
+  uint32_t _nodes;          ///< nodes examined by the last search
+
+  void (*_cbMoveHandler)(cell_t pos, int8_t player); ///< callback into user code to process the move
+
+  line_t makeMove(cell_t pos, int8_t player)
+  // Put the player in the cell and update the line counts and score
+  // without any checks. Returns the line won by the move or NO_LINE.
+  {
+    uint8_t p = (player == TTT_P1 ? 0 : 1);
+    line_t win = NO_LINE;
+
+    _board[p].set(pos);
+    _movesLeft--;
+    for (uint8_t n=0; n<CELL_LINES; n++)
+    {
+      line_t l = cellLine(pos, n);
+
+      if (l == NO_LINE) break;
+      _score -= lineScore(_count[0][l], _count[1][l]);
+      if (++_count[p][l] == K) win = l;
+      _score += lineScore(_count[0][l], _count[1][l]);
+    }
+
+    return(win);
+  }
+
+  void unmakeMove(cell_t pos, int8_t player)
+  // Reverse makeMove() for the same cell and player
+  {
+    uint8_t p = (player == TTT_P1 ? 0 : 1);
+
+    _board[p].reset(pos);
+    _movesLeft++;
+    for (uint8_t n=0; n<CELL_LINES; n++)
+    {
+      line_t l = cellLine(pos, n);
+
+      if (l == NO_LINE) break;
+      _score -= lineScore(_count[0][l], _count[1][l]);
+      _count[p][l]--;
+      _score += lineScore(_count[0][l], _count[1][l]);
+    }
+  }
+
+  bool nearToken(cell_t pos)
+  // true if any of the 8 cells around pos has a token
+  {
+    int8_t r0 = rowOf(pos), c0 = colOf(pos);
+
+    for (int8_t r=r0-1; r<=r0+1; r++)
+      for (int8_t c=c0-1; c<=c0+1; c++)
+        if (r >= 0 && r < Rows && c >= 0 && c < Cols && (_board[0].test(r*Cols+c) || _board[1].test(r*Cols+c)))
+          return(true);
+
+    return(false);
+  }
+
+  uint8_t orderMoves(cell_t *order, int8_t player)
+  // Put up to BRANCH of the candidate cells into order, most promising
+  // first, and return how many there are. A cell is ranked on the scores
+  // of the open lines through it for both players (attack and defence).
+  {
+    uint8_t p = (player == TTT_P1 ? 0 : 1);
+    score_t key[BRANCH];
+    uint8_t count = 0;
+
+    for (cell_t k=0; k<BOARD_SIZE; k++)
+    {
+      if (_board[0].test(k) || _board[1].test(k))
+        continue;
+      if (BOARD_SIZE > 16 && _movesLeft != BOARD_SIZE && !nearToken(k))
+        continue;
+      if (BOARD_SIZE > 16 && _movesLeft == BOARD_SIZE && k != BOARD_SIZE / 2)
+        continue;     // first move on a large board goes in the middle
+
+      score_t v = 0;
+
+      for (uint8_t n=0; n<CELL_LINES; n++)
+      {
+        line_t l = cellLine(k, n);
+
+        if (l == NO_LINE) break;
+
+        uint8_t own = _count[p][l], opp = _count[1-p][l];
+
+        if (opp == 0) v += 2 * tokenScore(own + 1); // attack scores a little more than
+        if (own == 0) v += tokenScore(opp + 1);     // the same defence
+      }
+
+      // insert into the ordered list, dropping the worst if it is full
+      uint8_t j = (count < BRANCH ? count++ : BRANCH);
+
+      for (; j>0 && key[j-1] < v; j--)
+      {
+        if (j < BRANCH)
+        {
+          key[j] = key[j-1];
+          order[j] = order[j-1];
+        }
+      }
+      if (j < BRANCH)
+      {
+        key[j] = v;
+        order[j] = k;
+      }
+    }
+
+    return(count);
+  }
+
+  score_t negamax(int8_t player, uint8_t depth, score_t alpha, score_t beta, cell_t *pMove)
+  // Negamax search with alpha-beta pruning. Returns the score of the
+  // board for the player about to move.
+  {
+    cell_t  order[BRANCH];
+    uint8_t count;
+    score_t best = -SCORE_INF;
+
+    if (_movesLeft == 0)
+      return(0);
+    if (depth == 0)
+      return(player == TTT_P1 ? _score : -_score);
+
+    count = orderMoves(order, player);
+    for (uint8_t n=0; n<count; n++)
+    {
+      score_t score;
+
+      _nodes++;
+      if (makeMove(order[n], player) != NO_LINE)
+        score = SCORE_WIN + depth;    // win, better the sooner it happens
+      else
+        score = -negamax(-player, depth - 1, -beta, -alpha, NULL);
+      unmakeMove(order[n], player);
+
+      if (score > best)
+      {
+        best = score;
+        if (pMove != NULL) *pMove = order[n];
+        if (best > alpha) alpha = best;
+        if (alpha >= beta) break;
+      }
+    }
+
+    return(best);
+  }
+
+  cell_t searchMove(int8_t player)
+  // Determine the best move by searching the game tree. If the search 
+  // has no candidate cells (none next to a token) take any empty cell.
+  {
+    cell_t p = BOARD_SIZE;
+
+    _nodes = 0;
+    negamax(player, _depth, -SCORE_INF, SCORE_INF, &p);
+    for (cell_t k=0; k<BOARD_SIZE && p >= BOARD_SIZE; k++)
+      if (!_board[0].test(k) && !_board[1].test(k))
+        p = k;
+
+    return(p);
+  }
+};
+
+#endif
@@ -0,0 +1,310 @@
+/*
+  MD_TTT_Pool.cpp - Arduino library for TicTacToe game decision engine
+  Copyright (C) 2013 Marco Colli
+  All rights reserved.
+
+  Fixed size pool of TicTacToe games.
+
+  See MD_TTT.h for complete comments
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <MD_TTT_Pool.h>
+#include "MD_TTT_lib.h"
+
+// Game status byte
+#define POOL_USED     0x80  ///< the game is in use
+#define POOL_OVER     0x40  ///< the game is over
+#define POOL_AUTO     0x30  ///< the auto player, 0 none, 1 TTT_P1, 2 TTT_P2
+#define POOL_LINE     0x0f  ///< the winning line, or POOL_NO_LINE
+#define POOL_NO_LINE  0x0f
+
+#define POOL_AUTO_SHIFT 4
+#define POOL_LINES_START 0x33333333UL ///< all the lines at 0, offset by 3
+#define POOL_LINES_WIN   0x66666666UL ///< all the lines won by TTT_P1
+
+#ifdef __AVR__
+#define POOL_ALIGN  4   ///< no cache to align to
+#else
+#define POOL_ALIGN  64  ///< cache line size
+#endif
+
+// The game matrix change for a TTT_P1 move into each cell, 1 in the
+// 4 bits for each line through the cell. A TTT_P2 move subtracts it.
+// A line value is in the range [-3..3], so once offset by 3 a line
+// never carries into the next one.
+constexpr uint32_t poolCellDelta(uint8_t k, uint8_t l = 0)
+{
+  return(l == TTT_WIN_LINES ? 0 : (((tttLineMask(l) >> k) & 1) ? (1UL << (4 * l)) : 0) | poolCellDelta(k, l + 1));
+}
+
+static const uint32_t poolCellLines[TTT_BOARD_SIZE] PROGMEM = TTT_CELL_TABLE(poolCellDelta);
+
+static_assert(poolCellDelta(0) == 0x00010011UL && poolCellDelta(4) == 0x10100101UL, "pool cell lines");
+
+MD_TTTPool::MD_TTTPool(void *buf, size_t size, void (*mh)(tttHandle h, uint8_t pos, int8_t player)) :
+  _lines(NULL), _boardP1(NULL), _boardP2(NULL), _status(NULL), _size(0), _free(0),
+  _freeHead(TTT_POOL_NONE), _random(0), _cbMoveHandler(mh), _cbBatchHandler(NULL)
+{
+  uintptr_t start = ((uintptr_t)buf + POOL_ALIGN - 1) & ~(uintptr_t)(POOL_ALIGN - 1);
+  uint32_t n;
+
+  if (buf == NULL || size < (start - (uintptr_t)buf) + TTT_POOL_GAME_SIZE)
+    return;
+
+  n = (size - (start - (uintptr_t)buf)) / TTT_POOL_GAME_SIZE;
+  if (n > TTT_POOL_NONE - 1)
+    n = TTT_POOL_NONE - 1;
+  _size = _free = n;
+
+  // the arrays in order of alignment, widest first
+  _lines = (uint32_t *)start;
+  _boardP1 = (uint16_t *)(_lines + _size);
+  _boardP2 = _boardP1 + _size;
+  _status = (uint8_t *)(_boardP2 + _size);
+
+  // all the games are free
+  for (uint16_t i=0; i<_size; i++)
+  {
+    _status[i] = 0;
+    _lines[i] = i + 1;
+  }
+  _lines[_size - 1] = TTT_POOL_NONE;
+  _freeHead = 0;
+
+  DEBUG("\nMD_TTTPool games ", _size);
+}
+
+bool MD_TTTPool::inUse(tttHandle h)
+{
+  return(h < _size && (_status[h] & POOL_USED));
+}
+
+tttHandle MD_TTTPool::acquire(void)
+{
+  tttHandle h = _freeHead;
+
+  if (h == TTT_POOL_NONE)
+    return(TTT_POOL_NONE);
+
+  _freeHead = (tttHandle)_lines[h];
+  _free--;
+
+  _lines[h] = POOL_LINES_START;
+  _boardP1[h] = _boardP2[h] = 0;
+  _status[h] = POOL_USED | POOL_NO_LINE;
+
+  return(h);
+}
+
+bool MD_TTTPool::release(tttHandle h)
+{
+  if (!inUse(h))
+    return(false);
+
+  _status[h] = 0;
+  _lines[h] = _freeHead;
+  _freeHead = h;
+  _free++;
+
+  return(true);
+}
+
+bool MD_TTTPool::start(tttHandle h)
+{
+  if (!inUse(h))
+    return(false);
+
+  _lines[h] = POOL_LINES_START;
+  _boardP1[h] = _boardP2[h] = 0;
+  _status[h] = (_status[h] & (POOL_USED | POOL_AUTO)) | POOL_NO_LINE;
+
+  // run the callback to sync the user board
+  if (_cbMoveHandler != NULL)
+    for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+      (_cbMoveHandler)(h, i, TTT_P0);
+
+  return(true);
+}
+
+bool MD_TTTPool::setAutoPlayer(tttHandle h, int8_t p)
+{
+  if (!inUse(h) || ((p != TTT_P0) && (p != TTT_P1) && (p != TTT_P2)))
+    return(false);
+
+  _status[h] &= ~POOL_AUTO;
+  if (p != TTT_P0)
+    _status[h] |= (p == TTT_P1 ? 1 : 2) << POOL_AUTO_SHIFT;
+
+  return(true);
+}
+
+int8_t MD_TTTPool::getAutoPlayer(tttHandle h)
+{
+  if (!inUse(h))
+    return(TTT_P0);
+
+  switch ((_status[h] & POOL_AUTO) >> POOL_AUTO_SHIFT)
+  {
+  case 1: return(TTT_P1);
+  case 2: return(TTT_P2);
+  }
+
+  return(TTT_P0);
+}
+
+uint8_t MD_TTTPool::autoMove(tttHandle h, int8_t player)
+// Select a move from the lines at each score, as the MD_TTT heuristic
+// engine does.
+{
+  uint16_t empty = ~(_boardP1[h] | _boardP2[h]) & TTT_BOARD_MASK;
+  uint8_t  sets[7] = { 0 };
+  uint32_t lines = _lines[h];
+
+  // the nibbles are the line scores offset by 3, standardized for player
+  for (uint8_t mask=0x80; mask != 0; mask >>= 1, lines >>= 4)
+    sets[player < 0 ? 6 - (lines & 0xf) : (lines & 0xf)] |= mask;
+
+  return(MD_TTT::selectMove(sets, empty, &_random));
+}
+
+uint8_t MD_TTTPool::play(tttHandle h, uint8_t *pPos, int8_t player)
+// Make the move without the callback, working out the auto player
+// move first. The lines through the cell are checked for a win all at
+// once: a complete line is a nibble of 6 (TTT_P1) or 0 (TTT_P2), and
+// the nibbles are tested for 0 together as in the SWAR zero byte test.
+{
+  if (!inUse(h) || (_status[h] & POOL_OVER) || ((player != TTT_P1) && (player != TTT_P2)))
+    return(TTT_POOL_ERROR);
+
+  if (player == getAutoPlayer(h))
+    *pPos = autoMove(h, player);
+
+  uint8_t pos = *pPos;
+
+  if (pos >= TTT_BOARD_SIZE) return(TTT_POOL_ERROR);
+  if ((_boardP1[h] | _boardP2[h]) & CELL_MASK(pos)) return(TTT_POOL_ERROR);
+
+  uint32_t delta = pgm_read_dword(&poolCellLines[pos]);
+  uint32_t lines, win;
+
+  if (player == TTT_P1)
+  {
+    _boardP1[h] |= CELL_MASK(pos);
+    lines = _lines[h] += delta;
+    win = lines ^ POOL_LINES_WIN;
+  }
+  else
+  {
+    _boardP2[h] |= CELL_MASK(pos);
+    lines = _lines[h] -= delta;
+    win = lines;
+  }
+  win = (win - 0x11111111UL) & ~win & 0x88888888UL;
+
+  if (win != 0)
+  {
+    uint8_t line = TTT_WIN_LINES - 1;
+
+    // the highest line won, as MD_TTT reports
+    for (; !(win & 0x80000000UL); win <<= 4)
+      line--;
+    _status[h] = (_status[h] & ~POOL_LINE) | POOL_OVER | line;
+  }
+  else if ((_boardP1[h] | _boardP2[h]) == TTT_BOARD_MASK)
+    _status[h] |= POOL_OVER;
+
+  return(_status[h] & POOL_OVER ? TTT_POOL_OVER : TTT_POOL_MOVED);
+}
+
+bool MD_TTTPool::doMove(tttHandle h, uint8_t pos, int8_t player, bool silent)
+{
+  if (play(h, &pos, player) == TTT_POOL_ERROR)
+    return(false);
+
+  if (!silent && _cbMoveHandler != NULL)
+    (_cbMoveHandler)(h, pos, player);
+
+  return(true);
+}
+
+uint16_t MD_TTTPool::doMoves(tttPoolMove *moves, uint16_t count, bool silent)
+// Make all the moves first, then tell the user code about them.
+{
+  uint16_t n = 0;
+
+  for (uint16_t i=0; i<count; i++)
+  {
+    moves[i].result = play(moves[i].h, &moves[i].pos, moves[i].player);
+    if (moves[i].result != TTT_POOL_ERROR)
+      n++;
+  }
+
+  if (!silent)
+  {
+    if (_cbBatchHandler != NULL)
+      (_cbBatchHandler)(moves, count);
+    else if (_cbMoveHandler != NULL)
+    {
+      for (uint16_t i=0; i<count; i++)
+        if (moves[i].result != TTT_POOL_ERROR)
+          (_cbMoveHandler)(moves[i].h, moves[i].pos, moves[i].player);
+    }
+  }
+
+  return(n);
+}
+
+int8_t MD_TTTPool::getBoardPosition(tttHandle h, uint8_t pos)
+{
+  if (!inUse(h) || pos >= TTT_BOARD_SIZE)
+    return(TTT_P0);
+  if (_boardP1[h] & CELL_MASK(pos)) return(TTT_P1);
+  if (_boardP2[h] & CELL_MASK(pos)) return(TTT_P2);
+
+  return(TTT_P0);
+}
+
+bool MD_TTTPool::isGameOver(tttHandle h)
+{
+  return(inUse(h) && (_status[h] & POOL_OVER));
+}
+
+int8_t MD_TTTPool::getGameWinner(tttHandle h)
+// The winner is the player with all the cells in the winning line
+{
+  uint8_t line = getWinLine(h);
+
+  if (line == 0xff)
+    return(TTT_P0);
+
+  uint16_t cells = pgm_read_word(&TTT_wlm[line]);
+
+  return((_boardP1[h] & cells) == cells ? TTT_P1 : TTT_P2);
+}
+
+uint8_t MD_TTTPool::getWinLine(tttHandle h)
+{
+  if (!inUse(h) || (_status[h] & POOL_LINE) == POOL_NO_LINE)
+    return(0xff);
+
+  return(_status[h] & POOL_LINE);
+}
+
+void MD_TTTPool::setSeed(uint32_t seed)
+{
+  _random = MD_TTT::scrambleSeed(seed);
+}
@@ -0,0 +1,263 @@
+/*
+  MD_TTT_Pool.h - Arduino library for TicTacToe game decision engine
+  Copyright (C) 2013 Marco Colli
+  All rights reserved.
+
+  Fixed size pool of TicTacToe games.
+
+  See MD_TTT.h for complete comments
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#ifndef _MD_TTT_POOL_H
+#define _MD_TTT_POOL_H
+
+#include <MD_TTT.h>
+
+typedef uint16_t tttHandle;   ///< a game in an MD_TTTPool
+
+#define TTT_POOL_NONE       0xffff  ///< not a game handle
+#define TTT_POOL_GAME_SIZE  9       ///< bytes of pool memory for each game
+
+#define TTT_POOL_ERROR  0   ///< doMoves() result, the move was not made
+#define TTT_POOL_MOVED  1   ///< doMoves() result, the move was made
+#define TTT_POOL_OVER   2   ///< doMoves() result, the move was made and the game is over
+
+/**
+ * Move in a batch of moves.
+ *
+ * An array of these is given to MD_TTTPool::doMoves(). The calling 
+ * program sets the game, cell and player, and doMoves() sets the cell 
+ * actually played (the auto player chooses its own) and the result.
+ */
+typedef struct
+{
+  tttHandle h;    ///< the game
+  uint8_t pos;    ///< position on the board for the move [0..8]
+  int8_t player;  ///< player identifier TTT_P1 or TTT_P2
+  uint8_t result; ///< set by doMoves(), one of TTT_POOL_ERROR, TTT_POOL_MOVED or TTT_POOL_OVER
+} tttPoolMove;
+
+/**
+ * Pool of games.
+ *
+ * Holds many games in a block of memory supplied by the calling program,
+ * for a program that hosts a large number of games at once (eg, a game
+ * server). Each game takes TTT_POOL_GAME_SIZE bytes, against more than
+ * 200 for an MD_TTT object, and no memory is allocated for each game.
+ *
+ * The games are held as a structure of arrays: the bitboards for each
+ * player, the game matrix [M] with each line value in 4 bits, and a
+ * status byte. A game is identified by a handle, its index in the
+ * arrays. Free games are kept in a list, threaded through the game
+ * matrix array, so acquire() and release() take the same short time
+ * however many games are in use.
+ *
+ * The methods follow MD_TTT, with the game handle as the first
+ * parameter. The auto player uses the heuristic engine, with the moves
+ * scored from the game matrix when the move is needed. There is one
+ * random generator and one callback for the whole pool. A pool is not
+ * protected against concurrent access (see Thread Safety).
+ */
+class MD_TTTPool
+{
+  public:
+  /**
+   * Class Constructor.
+   *
+   * Divides the memory in _buf_ into as many games as will fit and puts
+   * them all in the free list. The memory must remain allocated for as
+   * long as the pool is used. The callback is invoked as for MD_TTT,
+   * with the handle of the game.
+   *
+   * \param buf   the memory for the games.
+   * \param size  the size of the memory in bytes.
+   * \param mh    pointer to user callback function, or NULL if not needed.
+   */
+  MD_TTTPool(void *buf, size_t size, void (*mh)(tttHandle h, uint8_t pos, int8_t player) = NULL);
+
+  /**
+   * Get the number of games in the pool.
+   *
+   * \return the number of games the memory holds, in use or free.
+   */
+  uint16_t getSize(void) { return(_size); }
+
+  /**
+   * Get the number of free games.
+   *
+   * \return the number of games that can still be acquired.
+   */
+  uint16_t getFree(void) { return(_free); }
+
+  /**
+   * Get a game from the pool.
+   *
+   * Takes a game from the free list and starts it, with no auto player.
+   *
+   * \return the handle of the game, or TTT_POOL_NONE if there are no free games.
+   */
+  tttHandle acquire(void);
+
+  /**
+   * Return a game to the pool.
+   *
+   * The handle must not be used again once the game is released.
+   *
+   * \param h the handle of the game.
+   * \return true if the game was released, false if the handle is not in use.
+   */
+  bool release(tttHandle h);
+
+  /**
+   * Reset the board for a new game.
+   *
+   * As for MD_TTT::start().
+   *
+   * \param h the handle of the game.
+   * \return true if no errors occurred, false otherwise.
+   */
+  bool start(tttHandle h);
+
+  /**
+   * Set the computer player.
+   *
+   * As for MD_TTT::setAutoPlayer(), using the heuristic engine.
+   *
+   * \param h the handle of the game.
+   * \param p the player identifier TTT_P1, TTT_P2 or TTT_P0 for none.
+   * \return true if no errors occurred, false otherwise.
+   */
+  bool setAutoPlayer(tttHandle h, int8_t p);
+
+  /**
+   * Get the computer player.
+   *
+   * \param h the handle of the game.
+   * \return the player identifier, one of TTT_P*.
+   */
+  int8_t getAutoPlayer(tttHandle h);
+
+  /**
+   * Execute the next game move.
+   *
+   * As for MD_TTT::doMove(). If _player_ is the auto player for the game
+   * then _pos_ is ignored and the auto player chooses the move. Unlike 
+   * MD_TTT::doMove(), no move is accepted once the game is over, so the 
+   * winner and winning line cannot be changed by a later move.
+   *
+   * \param h the handle of the game.
+   * \param pos position on the board for the move [0..8].
+   * \param player  player identifier TTT_P1 or TTT_P2.
+   * \param silent  set true to skip the callback.
+   * \return true if no errors occurred, false otherwise.
+   */
+  bool doMove(tttHandle h, uint8_t pos, int8_t player, bool silent = false);
+
+  /**
+   * Execute a batch of moves.
+   *
+   * Makes each move in the array in turn, as for doMove(), and records 
+   * the cell played and the result in the array. Once all the moves are 
+   * made the batch callback, if set, is invoked once with the whole array. 
+   * Otherwise the move callback is invoked for each move made. This suits 
+   * a game server that advances all its games each tick: the moves are 
+   * made in one tight loop with no calls back into the user code.
+   *
+   * A game may appear more than once in the array, and its moves are made 
+   * in array order.
+   *
+   * \param moves  the array of moves.
+   * \param count  the number of moves in the array.
+   * \param silent set true to skip the callbacks.
+   * \return the number of moves made.
+   */
+  uint16_t doMoves(tttPoolMove *moves, uint16_t count, bool silent = false);
+
+  /**
+   * Set the batch callback.
+   *
+   * The callback is invoked by doMoves() with the array of moves once they 
+   * have all been made, in place of the move callback for each move.
+   *
+   * \param bh pointer to user callback function, or NULL to use the move callback.
+   */
+  void setBatchHandler(void (*bh)(const tttPoolMove *moves, uint16_t count)) { _cbBatchHandler = bh; }
+
+  /**
+   * Get the occupier of a board position.
+   *
+   * \param h the handle of the game.
+   * \param pos the position to check.
+   * \return the player identifier, one of TTT_P*.
+   */
+  int8_t getBoardPosition(tttHandle h, uint8_t pos);
+
+  /**
+   * Check if the game is over.
+   *
+   * \param h the handle of the game.
+   * \return true if the game is over.
+   */
+  bool isGameOver(tttHandle h);
+
+  /**
+   * Get the winner of the game.
+   *
+   * \param h the handle of the game.
+   * \return the winning player identifier, one of TTT_P*.
+   */
+  int8_t getGameWinner(tttHandle h);
+
+  /**
+   * Get the winning line.
+   *
+   * If the winning move completed two lines this is the higher numbered 
+   * one, as for MD_TTT::getWinLine().
+   *
+   * \param h the handle of the game.
+   * \return the winning line id, one of TTT_WL_*, or 0xff if none.
+   */
+  uint8_t getWinLine(tttHandle h);
+
+  /**
+   * Seed the random generator.
+   *
+   * As for MD_TTT::setSeed(), for the random choices of all the games
+   * in the pool.
+   *
+   * \param seed  the seed value.
+   */
+  void setSeed(uint32_t seed);
+
+  protected:
+  uint32_t *_lines;     ///< game matrix [M], line i in bits 4i to 4i+3 offset by 3, or the next free game
+  uint16_t *_boardP1;   ///< the cells occupied by TTT_P1 in each game
+  uint16_t *_boardP2;   ///< the cells occupied by TTT_P2 in each game
+  uint8_t  *_status;    ///< game status bits, see MD_TTT_Pool.cpp
+  uint16_t _size;       ///< the number of games
+  uint16_t _free;       ///< the number of free games
+  tttHandle _freeHead;  ///< the first free game
+  uint32_t _random;     ///< xorshift32 random generator state, 0 if not seeded
+
+  void (*_cbMoveHandler)(tttHandle h, uint8_t pos, int8_t player); ///< callback into user code to process the move
+  void (*_cbBatchHandler)(const tttPoolMove *moves, uint16_t count); ///< callback into user code to process a batch of moves
+
+  bool inUse(tttHandle h);                    ///< true if h is a game in use
+  uint8_t autoMove(tttHandle h, int8_t player); ///< work out a move for the auto player
+  uint8_t play(tttHandle h, uint8_t *pPos, int8_t player); ///< make a move, returns TTT_POOL_ERROR, _MOVED or _OVER
+};
+
+#endif
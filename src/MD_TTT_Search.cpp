@@ -0,0 +1,495 @@
+/*
+  MD_TTT_Search.cpp - Arduino library for TicTacToe game decision engine
+  Copyright (C) 2013 Marco Colli
+  All rights reserved.
+
+  Game tree search engine for the auto player, and move analysis.
+
+  See MD_TTT.h for complete comments
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <MD_TTT.h>
+#include "MD_TTT_lib.h"
+
+// Search scores. A win scores the number of moves left + 1, so it is
+// always in the range [1..TTT_BOARD_SIZE], and a loss is the negative.
+#define SCORE_DRAW  0
+#define SCORE_INF   (TTT_BOARD_SIZE + 1)  ///< better than any possible score
+
+// Transposition table definitions
+#define TT_EMPTY    0   ///< entry not used
+#define TT_EXACT    1   ///< score is exact
+#define TT_LOWER    2   ///< score is a lower bound (search cut off high)
+#define TT_UPPER    3   ///< score is an upper bound (search failed low)
+
+#define TT_SIDE_P2  0x5a3c96e1UL  ///< hash key for TTT_P2 to move
+
+#define STEP_CHECK  8   ///< time-sliced search nodes between checks of the time budget
+
+#ifdef __AVR__
+#define TT_ALIGN    1   ///< no cache to align to
+#else
+#define TT_ALIGN    64  ///< cache line size
+#endif
+
+#if TTT_USE_HASH
+bool MD_TTT::setTransTable(void *buf, size_t size)
+{
+  uintptr_t start = ((uintptr_t)buf + TT_ALIGN - 1) & ~(uintptr_t)(TT_ALIGN - 1);
+  uint32_t entries = 1;
+
+  _ttTable = NULL;
+  _ttMask = 0;
+
+  if (buf == NULL)
+    return(true);
+
+  // work out the largest power of 2 entries that will fit after alignment
+  if (size < (start - (uintptr_t)buf) + sizeof(tttTransEntry))
+    return(false);
+  size -= (start - (uintptr_t)buf);
+  while (entries * 2 <= size / sizeof(tttTransEntry))
+    entries *= 2;
+
+  _ttTable = (tttTransEntry *)start;
+  _ttMask = entries - 1;
+  for (uint32_t i=0; i<entries; i++)
+    _ttTable[i].bound = TT_EMPTY;
+
+  DEBUG("\nsetTransTable entries ", entries);
+
+  return(true);
+}
+
+bool MD_TTT::ttProbe(int8_t player, int8_t *pAlpha, int8_t *pBeta, int8_t *pScore)
+// Look up the board, with player to move, in the transposition table and
+// narrow the search window with what was found. Returns true, with the
+// score in *pScore, if the window closes and the board need not be searched.
+{
+  uint32_t hash = getBoardHash() ^ (player == TTT_P2 ? TT_SIDE_P2 : 0);
+  tttTransEntry *pTT = &_ttTable[hash & _ttMask];
+
+  _ttProbes++;
+  if (pTT->bound == TT_EMPTY || pTT->check != (uint16_t)(hash >> 16))
+    return(false);
+
+  switch (pTT->bound)
+  {
+  case TT_EXACT: *pAlpha = *pBeta = pTT->score; break;
+  case TT_LOWER: if (pTT->score > *pAlpha) *pAlpha = pTT->score; break;
+  case TT_UPPER: if (pTT->score < *pBeta) *pBeta = pTT->score; break;
+  }
+  if (*pAlpha < *pBeta)
+    return(false);
+
+  _ttHits++;
+  *pScore = pTT->score;
+
+  return(true);
+}
+
+void MD_TTT::ttStore(int8_t player, int8_t score, int8_t alpha, int8_t beta)
+// Remember the score of the board, with player to move, searched with the 
+// window [alpha, beta]. The table entry is always replaced.
+{
+  uint32_t hash = getBoardHash() ^ (player == TTT_P2 ? TT_SIDE_P2 : 0);
+  tttTransEntry *pTT = &_ttTable[hash & _ttMask];
+
+  pTT->check = (uint16_t)(hash >> 16);
+  pTT->score = score;
+  if (score <= alpha)
+    pTT->bound = TT_UPPER;
+  else if (score >= beta)
+    pTT->bound = TT_LOWER;
+  else
+    pTT->bound = TT_EXACT;
+}
+#endif
+
+uint8_t MD_TTT::orderMoves(uint8_t *order, int8_t player)
+// Put the empty cells into order, most promising first, and return how
+// many there are. Moving into a cell only changes the scores histogram
+// for the lines through that cell, so the cells are ranked on those
+// changes using the priorities of the heuristic: making a 3 (win),
+// removing an opponent's 2 (block), then making the most 2's and 1's.
+{
+  uint16_t empty = ~(_boardP1 | _boardP2) & TTT_BOARD_MASK;
+  uint16_t key[TTT_BOARD_SIZE];
+  uint8_t count = 0;
+
+  for (uint8_t k=0; k<TTT_BOARD_SIZE; k++)
+  {
+    if (!(empty & CELL_MASK(k)))
+      continue;
+
+    // work out the sort key for this cell ...
+    uint16_t  v = 0;
+    uint8_t   lines = pgm_read_byte(&TTT_wwm[k]);
+
+    for (uint8_t i=0, mask=0x80; i<TTT_WIN_LINES; i++, mask>>=1)
+    {
+      if (lines & mask)
+      {
+        switch (_currState[i] * player)
+        {
+        case  2: v += 0x1000; break;  // win
+        case -2: v += 0x0100; break;  // block
+        case  1: v += 0x0010; break;  // make a 2
+        case  0: v += 0x0001; break;  // make a 1
+        }
+      }
+    }
+
+    // ... and insert it into the ordered list
+    uint8_t j = count++;
+
+    for (; j>0 && key[j-1] < v; j--)
+    {
+      key[j] = key[j-1];
+      order[j] = order[j-1];
+    }
+    key[j] = v;
+    order[j] = k;
+  }
+
+  return(count);
+}
+
+int8_t MD_TTT::negamax(int8_t player, int8_t alpha, int8_t beta, uint8_t *pMove)
+// Negamax search with alpha-beta pruning. Returns the score of the board
+// for the player about to move. If pMove is not NULL it is set to the
+// first move that achieves the best score.
+{
+  uint8_t order[TTT_BOARD_SIZE];
+  uint8_t count = orderMoves(order, player);
+  int8_t  best = -SCORE_INF;
+#if TTT_USE_HASH
+  int8_t  alphaIn = alpha;
+  // the root is always searched as we need the move, which is not kept 
+  // in the table
+  bool    useTT = (_ttTable != NULL && pMove == NULL);
+#endif
+
+  if (count == 0)  // board is full
+    return(SCORE_DRAW);
+
+#if TTT_USE_HASH
+  // check if this board has already been searched
+  if (useTT && ttProbe(player, &alpha, &beta, &best))
+    return(best);
+#endif
+
+  for (uint8_t n=0; n<count; n++)
+  {
+    int8_t score;
+
+    _searchNodes++;
+    if (makeMove(order[n], player) != 0xff)
+      score = _movesLeft + 1;   // win, better the sooner it happens
+    else
+      score = -negamax(-player, -beta, -alpha, NULL);
+    unmakeMove(order[n], player);
+
+    if (score > best)
+    {
+      best = score;
+      if (pMove != NULL) *pMove = order[n];
+      if (best > alpha) alpha = best;
+      if (alpha >= beta) break;   // the opponent will avoid this board
+    }
+  }
+
+#if TTT_USE_HASH
+  if (useTT)
+    ttStore(player, best, alphaIn, beta);
+#endif
+
+  return(best);
+}
+
+uint8_t MD_TTT::searchMove(int8_t player)
+// Determine the best move by searching the game tree
+{
+  uint8_t p = 0xff;
+
+  _searchNodes = 0;
+#if TTT_USE_HASH
+  _ttProbes = _ttHits = 0;
+#endif
+  negamax(player, -SCORE_INF, SCORE_INF, &p);
+
+  DEBUG("\nSearch move at cell ", CELL_ID(p));
+  DEBUG(" nodes ", _searchNodes);
+#if TTT_USE_HASH
+  DEBUG(" TT hits ", _ttHits);
+#endif
+
+  return(p);
+}
+
+#if TTT_USE_STEP
+// The time-sliced search is negamax() with the recursion replaced by a
+// stack of frames in the MD_TTT object, so it can stop between any two
+// nodes and carry on from there in the next call. It visits the nodes
+// in the same order and uses the transposition table in the same way,
+// so it finds the same move as searchMove().
+
+bool MD_TTT::stepEnter(uint8_t d, int8_t player, int8_t alpha, int8_t beta, int8_t *pScore)
+// Set up the frame for the board at depth d, as at the start of 
+// negamax(). Returns true, with the score in *pScore, if the board has 
+// already been searched and there is nothing more to do.
+{
+  stepFrame *f = &_stepFrame[d];
+
+  f->count = orderMoves(f->order, player);
+  f->alphaIn = alpha;
+
+#if TTT_USE_HASH
+  // the root is always searched as we need the move
+  if (_ttTable != NULL && d != 0 && ttProbe(player, &alpha, &beta, pScore))
+    return(true);
+#else
+  (void)pScore;
+#endif
+
+  f->n = 0;
+  f->best = -SCORE_INF;
+  f->alpha = alpha;
+  f->beta = beta;
+
+  return(false);
+}
+
+void MD_TTT::stepScore(uint8_t d, int8_t score)
+// Record the score for the move being searched in the frame at depth d 
+// and move on to the next move, or past the last one for a cut off.
+{
+  stepFrame *f = &_stepFrame[d];
+
+  if (score > f->best)
+  {
+    f->best = score;
+    if (d == 0) _stepMove = f->order[f->n];
+    if (f->best > f->alpha) f->alpha = f->best;
+  }
+  f->n = (f->alpha >= f->beta) ? f->count : f->n + 1;
+}
+
+bool MD_TTT::beginAutoMove(void)
+{
+  int8_t score;
+
+  _stepState = STEP_IDLE;
+  if (_gameOver || _autoPlayer == TTT_P0)
+    return(false);
+
+  _stepPlayer = _autoPlayer;
+  _stepP1 = _boardP1;
+  _stepP2 = _boardP2;
+
+  if (_autoEngine != TTT_ENGINE_SEARCH)
+  {
+    // quick enough to do now
+    _stepMove = doAutoMove(_stepPlayer);
+    _stepState = STEP_READY;
+    return(true);
+  }
+
+  DEBUG("\nbeginAutoMove P", _stepPlayer);
+  STATS(_stats.calls++);
+  _autoMode = TTT_MODE_SEARCH;
+  STATS(_stats.modeHits[_autoMode]++);
+
+  _searchNodes = 0;
+#if TTT_USE_HASH
+  _ttProbes = _ttHits = 0;
+#endif
+  _stepMove = 0xff;
+  _stepDepth = 1;
+  stepEnter(0, _stepPlayer, -SCORE_INF, SCORE_INF, &score);
+  _stepState = STEP_RUNNING;
+
+  return(true);
+}
+
+bool MD_TTT::stepAutoMove(uint32_t budget)
+{
+  uint32_t start = micros();
+  uint8_t check = 0;
+
+  if (_stepState == STEP_RUNNING && (_stepP1 != _boardP1 || _stepP2 != _boardP2))
+    _stepState = STEP_IDLE;   // the board has changed
+  if (_stepState != STEP_RUNNING)
+    return(isMoveReady());
+
+  // make the moves on the path to the current frame again
+  for (uint8_t d=0; d+1<_stepDepth; d++)
+    makeMove(_stepFrame[d].order[_stepFrame[d].n], (d & 1) ? -_stepPlayer : _stepPlayer);
+
+  while (_stepState == STEP_RUNNING)
+  {
+    uint8_t d = _stepDepth - 1;
+    stepFrame *f = &_stepFrame[d];
+    int8_t player = (d & 1) ? -_stepPlayer : _stepPlayer;
+
+    if (f->n < f->count)
+    {
+      uint8_t m = f->order[f->n];
+      int8_t score;
+
+      if (++check >= STEP_CHECK)
+      {
+        check = 0;
+        if (micros() - start >= budget)
+          break;
+      }
+
+      _searchNodes++;
+      if (makeMove(m, player) != 0xff)
+        score = _movesLeft + 1;   // win, better the sooner it happens
+      else if (_movesLeft == 0)
+        score = SCORE_DRAW;
+      else if (!stepEnter(d + 1, -player, -f->beta, -f->alpha, &score))
+      {
+        _stepDepth++;   // search the board after the move, leaving the move made
+        continue;
+      }
+      else
+        score = -score;
+      unmakeMove(m, player);
+      stepScore(d, score);
+    }
+    else
+    {
+#if TTT_USE_HASH
+      // all the moves searched, so remember the result ...
+      if (_ttTable != NULL && d != 0)
+        ttStore(player, f->best, f->alphaIn, f->beta);
+#endif
+
+      // ... and pass it back to the board before this move
+      _stepDepth--;
+      if (d == 0)
+      {
+        DEBUG("\nStepped search move at cell ", CELL_ID(_stepMove));
+        DEBUG(" nodes ", _searchNodes);
+        _stepState = STEP_READY;
+      }
+      else
+      {
+        unmakeMove(_stepFrame[d-1].order[_stepFrame[d-1].n], -player);
+        stepScore(d - 1, -f->best);
+      }
+    }
+  }
+
+  // take back the moves on the path, so the board is as it was
+  for (int8_t d=_stepDepth-2; d>=0; d--)
+    unmakeMove(_stepFrame[d].order[_stepFrame[d].n], (d & 1) ? -_stepPlayer : _stepPlayer);
+
+  return(isMoveReady());
+}
+
+bool MD_TTT::isMoveReady(void)
+{
+  return(_stepState == STEP_READY && _stepP1 == _boardP1 && _stepP2 == _boardP2);
+}
+
+uint8_t MD_TTT::getAutoMove(void)
+{
+  return(isMoveReady() ? _stepMove : 0xff);
+}
+#endif
+
+uint8_t MD_TTT::analyze(int8_t player, tttMoveInfo *moves, uint8_t size, bool exact)
+// Rank the legal moves. Each cell gets a sort key, larger is better, 
+// with the heuristic order from moveKey() in the low 11 bits. If exact, 
+// the search score is put in the bits above.
+{
+  uint16_t empty = ~(_boardP1 | _boardP2) & TTT_BOARD_MASK;
+  uint16_t key[TTT_BOARD_SIZE], bestKey = 0;
+  uint8_t  order[TTT_BOARD_SIZE];
+  int8_t   value[TTT_BOARD_SIZE];
+  uint8_t  count = 0;
+
+  if (_gameOver || ((player != TTT_P1) && (player != TTT_P2)))
+    return(0);
+
+#if TTT_USE_SCORES
+  uint8_t (*scores)[7] = _scores[player == TTT_P1 ? 0 : 1];
+#else
+  uint8_t scores[TTT_BOARD_SIZE][7];
+
+  boardScores(scores, player);
+#endif
+
+  if (exact)
+  {
+    _searchNodes = 0;
+#if TTT_USE_HASH
+    _ttProbes = _ttHits = 0;
+#endif
+  }
+
+  for (uint16_t b = empty; b != 0; b &= b - 1)
+  {
+    uint8_t  k = lowestBit(b);
+    uint16_t v = moveKey(scores[k], k);
+
+    if (v > bestKey) bestKey = v;
+
+    value[k] = TTT_VAL_UNKNOWN;
+    if (exact)
+    {
+      int8_t score;
+
+      _searchNodes++;
+      if (makeMove(k, player) != 0xff)
+        score = _movesLeft + 1;
+      else
+        score = -negamax(-player, -SCORE_INF, SCORE_INF, NULL);
+      unmakeMove(k, player);
+
+      value[k] = (score > 0 ? TTT_VAL_WIN : (score < 0 ? TTT_VAL_LOSS : TTT_VAL_DRAW));
+      v |= (uint16_t)(score + SCORE_INF) << 11;
+    }
+
+    // insert the cell into the ordered list
+    uint8_t j = count++;
+
+    for (; j>0 && key[j-1] < v; j--)
+    {
+      key[j] = key[j-1];
+      order[j] = order[j-1];
+    }
+    key[j] = v;
+    order[j] = k;
+  }
+
+  for (uint8_t n=0; n<count && n<size; n++)
+  {
+    uint8_t k = order[n];
+
+    moves[n].cell = k;
+    moves[n].mode = TTT_MODE_FIRST - ((key[n] >> 8) & 0x7);
+    moves[n].best = ((key[n] & 0x7ff) == bestKey);
+    moves[n].value = value[k];
+    memcpy(moves[n].scores, scores[k], sizeof(moves[n].scores));
+  }
+
+  return(count);
+}
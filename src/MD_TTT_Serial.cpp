@@ -0,0 +1,223 @@
+/*
+  MD_TTT_Serial.cpp - Arduino library for TicTacToe game decision engine
+  Copyright (C) 2013 Marco Colli
+  All rights reserved.
+
+  Saving and restoring the game state.
+
+  See MD_TTT.h for complete comments
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+
+#include <MD_TTT.h>
+#include "MD_TTT_lib.h"
+
+#if TTT_USE_UNDO
+uint8_t MD_TTT::serialize(uint8_t *buf, uint8_t size)
+{
+  if (buf == NULL || size < TTT_SERIAL_SIZE)
+    return(0);
+
+  buf[TTT_SER_VERSION] = TTT_SERIAL_VERSION;
+  buf[TTT_SER_P1] = _boardP1 & 0xff;
+  buf[TTT_SER_P1+1] = _boardP1 >> 8;
+  buf[TTT_SER_P2] = _boardP2 & 0xff;
+  buf[TTT_SER_P2+1] = _boardP2 >> 8;
+  buf[TTT_SER_AUTO] = (uint8_t)_autoPlayer;
+  buf[TTT_SER_ENGINE] = _autoEngine;
+  buf[TTT_SER_WINLINE] = _winLine;
+  buf[TTT_SER_WINNER] = (uint8_t)_gameWinner;
+  buf[TTT_SER_FLAGS] = (_gameOver ? 1 : 0);
+  for (uint8_t i=0; i<4; i++)
+    buf[TTT_SER_RANDOM+i] = (_random >> (8 * i)) & 0xff;
+  for (uint8_t i=0; i<4; i++)
+    buf[TTT_SER_START+i] = (_startRandom >> (8 * i)) & 0xff;
+  buf[TTT_SER_MOVETOP] = _moveTop;
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+    buf[TTT_SER_MOVES+i] = (i < _moveTop ? _moveStack[i] : 0);
+
+  return(TTT_SERIAL_SIZE);
+}
+
+bool MD_TTT::deserialize(const uint8_t *buf, uint8_t size, bool silent)
+{
+  tttStateView v(buf, size);
+  uint16_t p1, p2, b1 = 0, b2 = 0, used = 0;
+  uint8_t moves, top, winLine;
+  int8_t winner;
+
+  if (!v.isValid())
+  {
+    DEBUGS("\ndeserialize invalid buffer");
+    return(false);
+  }
+
+  // Check the contents make sense before changing anything. The moves 
+  // made must be the moves on the move stack, and any moves to be redone 
+  // must be to empty cells. undoMove() relies on the win bits and the 
+  // result, so these must be what playing the moves would give.
+  p1 = v.getBoardP1();
+  p2 = v.getBoardP2();
+  moves = v.getMoveCount();
+  top = buf[TTT_SER_MOVETOP];
+  if ((p1 & p2) || ((p1 | p2) & ~TTT_BOARD_MASK) || top < moves || top > TTT_BOARD_SIZE)
+    return(false);
+  if (v.getAutoPlayer() < TTT_P2 || v.getAutoPlayer() > TTT_P1)
+    return(false);
+  switch (v.getAutoEngine())
+  {
+  case TTT_ENGINE_HEURISTIC:
+  case TTT_ENGINE_SEARCH:
+#if TTT_USE_TABLE
+  case TTT_ENGINE_TABLE:
+#endif
+    break;
+
+  default:
+    return(false);
+  }
+
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+  {
+    uint8_t e = buf[TTT_SER_MOVES+i];
+    uint8_t pos = e & MOVE_CELL;
+    uint16_t *pBoard = (e & MOVE_P2 ? &b2 : &b1);
+    uint8_t line = 0xff;
+
+    if (i >= top)
+    {
+      if (e != 0) return(false);
+      continue;
+    }
+    if ((e & ~(MOVE_CELL | MOVE_P2 | MOVE_WIN)) || pos >= TTT_BOARD_SIZE || (used & CELL_MASK(pos)))
+      return(false);
+    used |= CELL_MASK(pos);
+
+    // the move wins the highest line through the cell it completes, as in makeMove()
+    *pBoard |= CELL_MASK(pos);
+    for (uint8_t l=0; l<TTT_WIN_LINES; l++)
+    {
+      uint16_t cells = pgm_read_word(&TTT_wlm[l]);
+
+      if ((cells & CELL_MASK(pos)) && (*pBoard & cells) == cells)
+        line = l;
+    }
+    if ((line != 0xff) != ((e & MOVE_WIN) != 0))
+      return(false);
+
+    if (i == moves - 1 && (b1 != p1 || b2 != p2))
+      return(false);
+  }
+
+  // There is a winner exactly when there is a winning line, which must 
+  // be on the winner's board, and otherwise neither player has a line.
+  // The game is over when it is won or the board is full.
+  winLine = v.getWinLine();
+  winner = v.getGameWinner();
+  if (winner < TTT_P2 || winner > TTT_P1 || (winner == TTT_P0) != (winLine == 0xff))
+    return(false);
+  if (winLine != 0xff)
+  {
+    uint16_t cells;
+
+    if (winLine >= TTT_WIN_LINES)
+      return(false);
+    cells = pgm_read_word(&TTT_wlm[winLine]);
+    if (((winner == TTT_P1 ? p1 : p2) & cells) != cells)
+      return(false);
+  }
+  else
+  {
+    for (uint8_t l=0; l<TTT_WIN_LINES; l++)
+    {
+      uint16_t cells = pgm_read_word(&TTT_wlm[l]);
+
+      if ((p1 & cells) == cells || (p2 & cells) == cells)
+        return(false);
+    }
+  }
+  if (v.isGameOver() != (winLine != 0xff || moves == TTT_BOARD_SIZE))
+    return(false);
+
+  // restore the saved values ...
+  _dirty |= (_boardP1 ^ p1) | (_boardP2 ^ p2);
+  _generation++;
+  _boardP1 = p1;
+  _boardP2 = p2;
+  _movesLeft = TTT_BOARD_SIZE - moves;
+  _autoPlayer = v.getAutoPlayer();
+  _autoEngine = v.getAutoEngine();
+  _winLine = winLine;
+  _gameWinner = winner;
+  _gameOver = v.isGameOver();
+  _random = v.getRandomState();
+  _startRandom = v.getStartRandom();
+  _moveTop = top;
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+    _moveStack[i] = buf[TTT_SER_MOVES+i];
+  _autoMode = TTT_MODE_NONE;
+
+  // ... and work out everything else from the board
+  rebuildState();
+
+  // a queue gets a cleared board and the occupied cells, the callback every cell
+  if (!silent)
+  {
+#if TTT_USE_EVENTS
+    bool queue = (_evtQueue != NULL);
+#else
+    bool queue = false;
+#endif
+
+    if (queue)
+      notifyClear();
+    for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+      if (!queue || getBoardPosition(i) != TTT_P0)
+        notifyCell(i, getBoardPosition(i));
+    notifyOver();
+  }
+
+  return(true);
+}
+
+void MD_TTT::rebuildState(void)
+// Work out the game matrix, the board hashes and the move scores from 
+// the bitboards. This takes the same time whatever moves have been made.
+{
+  for (uint8_t i=0; i<TTT_WIN_LINES; i++)
+  {
+    uint16_t cells = pgm_read_word(&TTT_wlm[i]);
+
+    _currState[i] = countBits(_boardP1 & cells) - countBits(_boardP2 & cells);
+  }
+
+#if TTT_USE_HASH
+  for (uint8_t i=0; i<ARRAY_SIZE(_hash); i++)
+    _hash[i] = 0;
+#endif
+  for (uint8_t k=0; k<TTT_BOARD_SIZE; k++)
+  {
+#if TTT_USE_HASH
+    if (_boardP1 & CELL_MASK(k)) updateHash(k, TTT_P1);
+    if (_boardP2 & CELL_MASK(k)) updateHash(k, TTT_P2);
+#endif
+#if TTT_USE_SCORES
+    if (!((_boardP1 | _boardP2) & CELL_MASK(k)))
+      scoreCell(k);   // scores are only kept for the empty cells
+#endif
+  }
+}
+#endif
@@ -0,0 +1,1245 @@
+// MD_TTT perfect play table - 5478 reachable boards
+//
+// Generated by tools/MD_TTT_TableGen.cpp - DO NOT EDIT.
+// See the generator for a description of the table format.
+//
+#include <MD_TTT.h>
+
+#if TTT_USE_TABLE
+
+extern const uint8_t TTT_perfectTable[19683] PROGMEM =
+{
+  0x10, 0xff, 0x14, 0xff, 0xff, 0x13, 0x10, 0x23, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x24,
+  0xff, 0x25, 0x14, 0x23, 0xff, 0x14, 0xff, 0x14, 0xff, 0x23, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff,
+  0xff, 0x20, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x20, 0xff, 0x01,
+  0xff, 0xff, 0x24, 0x20, 0x26, 0xff, 0x10, 0x21, 0xff, 0x20, 0xff, 0x06, 0xff, 0x14, 0xff, 0x20,
+  0xff, 0x06, 0xff, 0xff, 0x06, 0x28, 0x24, 0xff, 0xff, 0x14, 0xff, 0x14, 0x24, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x26, 0x10, 0xff, 0x11, 0xff, 0xff, 0x27, 0x10, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x25, 0xff, 0xff, 0xff, 0x25, 0xff, 0x0f, 0x20, 0xff, 0x16, 0xff, 0xff, 0x27, 0x10, 0x28, 0xff,
+  0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x10, 0x28, 0xff, 0x27, 0xff, 0x27, 0xff,
+  0x28, 0xff, 0x10, 0x11, 0xff, 0x10, 0xff, 0x08, 0xff, 0x17, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff,
+  0x18, 0x17, 0x17, 0xff, 0xff, 0x16, 0xff, 0x06, 0x16, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x08,
+  0xff, 0xff, 0x18, 0x07, 0x26, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x17, 0xff, 0x05, 0x06,
+  0x26, 0xff, 0x16, 0xff, 0x05, 0xff, 0x26, 0xff, 0xff, 0x15, 0xff, 0x05, 0x22, 0xff, 0xff, 0xff,
+  0xff, 0x15, 0x21, 0xff, 0x20, 0xff, 0x05, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x28, 0x10, 0xff, 0x01, 0xff, 0xff, 0x24, 0x00, 0x23, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x0f, 0x10, 0xff, 0x16, 0xff, 0xff, 0x26, 0x10,
+  0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0x10, 0x11, 0xff, 0x10, 0xff,
+  0x16, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x23, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff,
+  0x22, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x10, 0xff, 0x01, 0xff,
+  0xff, 0x27, 0x10, 0x28, 0xff, 0x10, 0xff, 0x08, 0xff, 0xff, 0x18, 0x07, 0x17, 0xff, 0xff, 0xff,
+  0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0x06, 0x16, 0xff, 0x16, 0xff, 0x03, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0x07, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0x06, 0xff, 0x01, 0xff, 0xff, 0x06, 0x00, 0x26, 0xff, 0x10, 0x22, 0xff, 0x22, 0xff,
+  0x02, 0xff, 0x17, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x28, 0x28, 0xff, 0xff, 0x16, 0xff,
+  0x16, 0x16, 0xff, 0xff, 0xff, 0xff, 0x12, 0x22, 0xff, 0x22, 0xff, 0x14, 0xff, 0x26, 0xff, 0x20,
+  0xff, 0x13, 0xff, 0xff, 0x24, 0x13, 0x24, 0xff, 0xff, 0x08, 0xff, 0x08, 0x08, 0xff, 0xff, 0xff,
+  0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0x12, 0x12, 0x26, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff,
+  0x26, 0xff, 0x14, 0x18, 0x26, 0xff, 0x28, 0xff, 0x18, 0xff, 0x26, 0xff, 0xff, 0x24, 0xff, 0x24,
+  0x22, 0xff, 0xff, 0xff, 0xff, 0x24, 0x21, 0xff, 0x20, 0xff, 0x04, 0xff, 0x24, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x11, 0xff, 0xff, 0x27, 0x10, 0x28, 0xff,
+  0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x18, 0x28, 0xff, 0x27, 0xff, 0x27, 0xff,
+  0x28, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x26, 0x18, 0xff, 0x01, 0xff, 0xff, 0x27, 0x00, 0x26, 0xff, 0x20, 0x28, 0xff,
+  0x27, 0xff, 0x27, 0xff, 0x28, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0xff,
+  0x28, 0xff, 0x27, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0x03, 0x22, 0xff, 0xff, 0xff,
+  0xff, 0x13, 0x21, 0xff, 0x20, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0x10, 0x26, 0xff, 0x20, 0xff, 0x18, 0xff, 0x26, 0xff, 0x20, 0xff, 0x18, 0xff,
+  0xff, 0x18, 0x17, 0x26, 0xff, 0xff, 0x26, 0xff, 0x00, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x20, 0xff, 0x01, 0xff, 0xff,
+  0x27, 0x20, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x24,
+  0xff, 0x27, 0xff, 0xff, 0x24, 0x28, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff,
+  0x24, 0x14, 0x28, 0xff, 0x27, 0xff, 0x27, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff,
+  0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x27, 0xff, 0x11, 0xff, 0xff, 0x27, 0x10, 0x28, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff,
+  0x18, 0x17, 0x23, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x17, 0xff, 0x03, 0x10, 0x23, 0xff,
+  0x10, 0xff, 0x18, 0xff, 0x23, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x20, 0xff, 0x02, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0x20, 0xff, 0x01, 0xff, 0xff, 0x18, 0x20, 0xff,
+  0xff, 0x15, 0x15, 0xff, 0x15, 0xff, 0x02, 0xff, 0x02, 0xff, 0x15, 0xff, 0x01, 0xff, 0xff, 0x05,
+  0x00, 0x05, 0xff, 0xff, 0x15, 0xff, 0x15, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x24, 0x10, 0xff, 0x11, 0xff, 0xff, 0x27, 0x10, 0x28, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x10, 0xff, 0x0f, 0xff, 0xff,
+  0x28, 0xff, 0xff, 0xff, 0x17, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28,
+  0x10, 0xff, 0x01, 0xff, 0xff, 0x18, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+  0xff, 0x20, 0xff, 0x0f, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x17, 0x17, 0xff, 0xff, 0xff, 0x28,
+  0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0x10, 0x11, 0xff, 0x10, 0xff, 0x18, 0xff, 0x17, 0xff, 0x20,
+  0xff, 0x18, 0xff, 0xff, 0x24, 0x20, 0x23, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff,
+  0x24, 0x28, 0x23, 0xff, 0x28, 0xff, 0x18, 0xff, 0x23, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff,
+  0x20, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x20, 0xff, 0x01, 0xff,
+  0xff, 0x18, 0x20, 0xff, 0xff, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff,
+  0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff, 0x01, 0xff, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x28, 0xff, 0x01, 0xff, 0xff, 0x27, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x22, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x28, 0xff, 0x27, 0xff, 0x27, 0xff, 0x28,
+  0xff, 0x13, 0x23, 0xff, 0x13, 0xff, 0x02, 0xff, 0x23, 0xff, 0x13, 0xff, 0x01, 0xff, 0xff, 0x03,
+  0x00, 0x23, 0xff, 0xff, 0x23, 0xff, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x18, 0xff,
+  0xff, 0x18, 0x20, 0xff, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x20, 0xff, 0x07, 0x20, 0xff,
+  0xff, 0x20, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0x14, 0x21, 0xff, 0x20, 0xff, 0x03, 0xff, 0x14, 0xff, 0x20, 0xff, 0x03, 0xff, 0xff,
+  0x03, 0x14, 0x28, 0xff, 0xff, 0x04, 0xff, 0x14, 0x24, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x14,
+  0xff, 0xff, 0x24, 0x14, 0x24, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0x14,
+  0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x21, 0xff, 0x20, 0x22, 0xff, 0xff, 0xff,
+  0xff, 0x20, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff,
+  0xff, 0xff, 0xff, 0x10, 0xff, 0x13, 0xff, 0xff, 0x27, 0x10, 0x28, 0xff, 0xff, 0xff, 0x13, 0xff,
+  0xff, 0xff, 0x25, 0xff, 0x13, 0x11, 0x28, 0xff, 0x27, 0xff, 0x27, 0xff, 0x28, 0xff, 0xff, 0xff,
+  0x25, 0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25,
+  0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x25, 0x25, 0xff, 0x10, 0x28, 0xff, 0x27, 0xff, 0x0f, 0xff,
+  0x28, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x10, 0x28, 0xff, 0xff, 0x28, 0xff, 0x27, 0x27,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x02, 0x22, 0xff, 0xff, 0xff, 0xff, 0x10, 0x21, 0xff,
+  0x20, 0xff, 0x03, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x02,
+  0x12, 0xff, 0x12, 0xff, 0x02, 0xff, 0x02, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff, 0x18, 0x17, 0x17,
+  0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0x03, 0xff, 0xff, 0x03, 0x14, 0x24, 0xff, 0xff, 0xff,
+  0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0x14, 0x24, 0xff, 0x24, 0xff, 0x03, 0xff, 0x24, 0xff,
+  0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0x10, 0x22, 0xff, 0x20, 0xff,
+  0x0f, 0xff, 0x28, 0xff, 0x28, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x28, 0x28, 0xff, 0xff, 0x14, 0xff,
+  0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x23, 0xff, 0x23, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0x23, 0xff, 0x23, 0xff, 0xff, 0x23, 0x23, 0x23,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x0f, 0xff,
+  0xff, 0x0f, 0x10, 0x28, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0x0f, 0x10, 0x28,
+  0xff, 0x27, 0xff, 0x0f, 0xff, 0x28, 0xff, 0x02, 0x22, 0xff, 0x22, 0xff, 0x02, 0xff, 0x02, 0xff,
+  0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x28, 0x28, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0x02, 0xff, 0x01, 0xff, 0xff, 0x02, 0x00, 0x02, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff,
+  0xff, 0x28, 0xff, 0x28, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff,
+  0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x28, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x28, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x14, 0x22, 0xff, 0xff, 0xff,
+  0xff, 0x10, 0x21, 0xff, 0x20, 0xff, 0x03, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0x12, 0x12, 0xff, 0x12, 0xff, 0x14, 0xff, 0x02, 0xff, 0x10, 0xff, 0x14, 0xff,
+  0xff, 0x14, 0x14, 0x14, 0xff, 0xff, 0x01, 0xff, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x28, 0xff, 0x27, 0xff, 0x27, 0xff,
+  0x28, 0xff, 0x20, 0xff, 0x13, 0xff, 0xff, 0x27, 0x10, 0x28, 0xff, 0xff, 0x28, 0xff, 0x27, 0x27,
+  0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x11, 0xff, 0xff, 0x27, 0x12, 0x28, 0xff, 0xff, 0xff, 0x11,
+  0xff, 0xff, 0xff, 0x10, 0xff, 0x17, 0x18, 0x28, 0xff, 0x27, 0xff, 0x27, 0xff, 0x28, 0xff, 0xff,
+  0x28, 0xff, 0x27, 0x22, 0xff, 0xff, 0xff, 0xff, 0x20, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x28,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x12, 0x22, 0xff, 0xff, 0xff, 0xff, 0x10, 0x21,
+  0xff, 0x20, 0xff, 0x18, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff,
+  0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x28, 0xff, 0x01,
+  0xff, 0xff, 0x24, 0x10, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0x0f, 0x24, 0xff, 0x26, 0xff, 0xff, 0x24, 0x10, 0x28, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff,
+  0x26, 0xff, 0x26, 0x14, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x21, 0xff, 0xff, 0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x26, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x26, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x10, 0x28, 0xff, 0x10, 0xff, 0x08,
+  0xff, 0xff, 0x08, 0x10, 0x26, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0x06,
+  0x26, 0xff, 0x06, 0xff, 0x03, 0xff, 0x26, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x26, 0xff,
+  0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x26, 0xff, 0x01, 0xff, 0xff, 0x05,
+  0x00, 0x26, 0xff, 0x05, 0x15, 0xff, 0x05, 0xff, 0x02, 0xff, 0x15, 0xff, 0x15, 0xff, 0x01, 0xff,
+  0xff, 0x05, 0x15, 0x15, 0xff, 0xff, 0x01, 0xff, 0x00, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x28, 0xff, 0x02, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x10, 0xff, 0x01, 0xff, 0xff, 0x24, 0x10, 0x28, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x10, 0xff, 0x0f,
+  0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0x16, 0xff, 0x01, 0xff, 0xff, 0x03, 0x00, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+  0xff, 0xff, 0xff, 0x00, 0xff, 0x0f, 0x28, 0xff, 0x01, 0xff, 0xff, 0x02, 0x28, 0x28, 0xff, 0xff,
+  0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0x16, 0x16, 0xff, 0x16, 0xff, 0x06, 0xff, 0x16,
+  0xff, 0x24, 0xff, 0x14, 0xff, 0xff, 0x24, 0x10, 0x26, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff,
+  0x26, 0xff, 0x26, 0x28, 0x28, 0xff, 0x24, 0xff, 0x24, 0xff, 0x28, 0xff, 0xff, 0xff, 0x11, 0xff,
+  0xff, 0xff, 0x26, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x28, 0xff,
+  0x01, 0xff, 0xff, 0x24, 0x00, 0x26, 0xff, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x14, 0xff,
+  0x24, 0xff, 0x01, 0xff, 0xff, 0x24, 0x14, 0x24, 0xff, 0xff, 0x01, 0xff, 0x24, 0x24, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x26, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x26, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x00, 0x28, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x21, 0xff, 0xff, 0xff, 0x00, 0xff, 0x0f, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x26, 0x28,
+  0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x21, 0x21, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0xff, 0x03, 0x13, 0xff, 0x03, 0xff, 0x02, 0xff, 0x13, 0xff, 0x13, 0xff, 0x01, 0xff,
+  0xff, 0x03, 0x13, 0x13, 0xff, 0xff, 0x01, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff,
+  0x18, 0xff, 0xff, 0x18, 0x26, 0x26, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x26, 0xff, 0x18,
+  0x00, 0x26, 0xff, 0x00, 0xff, 0x06, 0xff, 0x26, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff,
+  0x28, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x28, 0xff, 0x28, 0xff,
+  0xff, 0x24, 0x28, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+  0xff, 0xff, 0xff, 0x28, 0xff, 0x0f, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x28, 0x23,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x28, 0xff, 0x28, 0xff,
+  0xff, 0x28, 0x28, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0x28, 0x28,
+  0xff, 0x28, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff,
+  0xff, 0x28, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x28, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x28, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff,
+  0x28, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x28, 0xff, 0x28, 0xff,
+  0xff, 0x24, 0x28, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f,
+  0x28, 0xff, 0x28, 0xff, 0xff, 0x24, 0x28, 0x28, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24,
+  0xff, 0x24, 0x28, 0x28, 0xff, 0x24, 0xff, 0x24, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+  0xff, 0xff, 0xff, 0x28, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x0f, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x28, 0x28, 0xff, 0x28, 0xff, 0x28, 0xff,
+  0xff, 0x28, 0x28, 0x23, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0x28, 0x23,
+  0xff, 0x28, 0xff, 0x28, 0xff, 0x23, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x20, 0xff, 0x28,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x20, 0xff, 0x28, 0xff, 0xff, 0x28, 0x20,
+  0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+  0x0f, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x03,
+  0xff, 0xff, 0x24, 0x10, 0x12, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x10, 0xff, 0x13, 0x14,
+  0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x14, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x10, 0xff,
+  0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x24, 0xff, 0x01, 0xff, 0xff, 0x24,
+  0x00, 0x24, 0xff, 0x00, 0x21, 0xff, 0x24, 0xff, 0x0f, 0xff, 0x12, 0xff, 0x20, 0xff, 0x0f, 0xff,
+  0xff, 0x0f, 0x10, 0x28, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x21, 0xff, 0xff, 0xff, 0x10, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13,
+  0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x10, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff,
+  0xff, 0x25, 0xff, 0x0f, 0x21, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0x28, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0x10, 0xff, 0x0f, 0x21, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0x02,
+  0x12, 0xff, 0x02, 0xff, 0x02, 0xff, 0x12, 0xff, 0x10, 0xff, 0x01, 0xff, 0xff, 0x03, 0x10, 0x13,
+  0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x01, 0xff, 0xff, 0x02,
+  0x12, 0x12, 0xff, 0xff, 0xff, 0x18, 0xff, 0xff, 0xff, 0x10, 0xff, 0x18, 0x0f, 0x0f, 0xff, 0x0f,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21,
+  0xff, 0x20, 0xff, 0x0f, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0x10, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0x24, 0xff, 0x01, 0xff, 0xff, 0x24, 0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0x24, 0xff, 0x0f, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x10, 0x28, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0x28, 0xff, 0x0f, 0x00, 0x24, 0xff, 0x24, 0xff, 0x0f, 0xff, 0x14,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x23, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x21, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10,
+  0x28, 0xff, 0x12, 0xff, 0x01, 0xff, 0xff, 0x02, 0x12, 0x12, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff,
+  0xff, 0x28, 0xff, 0x28, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x01,
+  0xff, 0xff, 0xff, 0x12, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x0f,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x00, 0x22, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x12,
+  0xff, 0x28, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x28, 0x28, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0x14, 0x21, 0xff, 0x24, 0xff, 0x24, 0xff, 0x12, 0xff, 0x21, 0xff, 0x13, 0xff,
+  0xff, 0x24, 0x10, 0x13, 0xff, 0xff, 0x01, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff,
+  0x12, 0xff, 0xff, 0x24, 0x12, 0x12, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x10, 0xff, 0x14,
+  0x00, 0x01, 0xff, 0x24, 0xff, 0x24, 0xff, 0x04, 0xff, 0xff, 0x24, 0xff, 0x24, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x10, 0x28, 0xff, 0xff, 0xff, 0x21,
+  0xff, 0xff, 0xff, 0x10, 0xff, 0x13, 0x21, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff,
+  0xff, 0x21, 0xff, 0xff, 0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x18, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x00, 0x28, 0xff, 0x21, 0x21, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0xff, 0x21, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0x28, 0xff, 0xff, 0x21, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x13, 0x21,
+  0xff, 0x20, 0xff, 0x03, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0x12, 0x12, 0xff, 0x12, 0xff, 0x02, 0xff, 0x12, 0xff, 0x10, 0xff, 0x18, 0xff, 0xff, 0x18, 0x10,
+  0x18, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x22, 0xff, 0x10, 0xff, 0x16, 0xff, 0x24, 0xff, 0x20,
+  0xff, 0x18, 0xff, 0xff, 0x16, 0x24, 0x24, 0xff, 0xff, 0x16, 0xff, 0x16, 0x16, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0x14, 0xff, 0xff, 0x14, 0x24, 0x26, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff,
+  0x24, 0xff, 0x24, 0x14, 0x26, 0xff, 0x14, 0xff, 0x14, 0xff, 0x26, 0xff, 0xff, 0x22, 0xff, 0x16,
+  0x22, 0xff, 0xff, 0xff, 0xff, 0x20, 0x21, 0xff, 0x20, 0xff, 0x06, 0xff, 0x24, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x13, 0xff, 0xff, 0x13, 0x20, 0x28, 0xff,
+  0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x13, 0x28, 0xff, 0x13, 0xff, 0x13, 0xff,
+  0x28, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x25, 0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x25, 0x25, 0xff, 0x10, 0x28, 0xff,
+  0x20, 0xff, 0x16, 0xff, 0x28, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0xff,
+  0x28, 0xff, 0x16, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x10, 0x22, 0xff, 0xff, 0xff,
+  0xff, 0x11, 0x21, 0xff, 0x20, 0xff, 0x18, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff,
+  0xff, 0xff, 0xff, 0x01, 0x26, 0xff, 0x20, 0xff, 0x18, 0xff, 0x0f, 0xff, 0x11, 0xff, 0x01, 0xff,
+  0xff, 0x18, 0x0f, 0x0f, 0xff, 0xff, 0x26, 0xff, 0x16, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x14, 0xff, 0xff, 0x13, 0x24,
+  0x24, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0x28, 0xff, 0x28, 0x14, 0x23, 0xff, 0x13, 0xff,
+  0x14, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0x10,
+  0x22, 0xff, 0x22, 0xff, 0x16, 0xff, 0x14, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x28, 0x28,
+  0xff, 0xff, 0x14, 0xff, 0x16, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff,
+  0x23, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0x23, 0xff, 0x23, 0xff,
+  0xff, 0x23, 0x23, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x22, 0xff, 0x16, 0xff, 0xff, 0x16, 0x22, 0x28, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26,
+  0xff, 0x26, 0x10, 0x28, 0xff, 0x10, 0xff, 0x16, 0xff, 0x28, 0xff, 0x01, 0x11, 0xff, 0x22, 0xff,
+  0x18, 0xff, 0x0f, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x0f, 0x0f, 0xff, 0xff, 0x01, 0xff,
+  0x16, 0x16, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x01, 0xff, 0xff, 0x18, 0x0f, 0x0f, 0xff, 0xff,
+  0xff, 0x28, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x00, 0x26, 0xff, 0x16, 0xff, 0x06, 0xff, 0x0f,
+  0xff, 0xff, 0x11, 0xff, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0x28, 0x21, 0xff, 0x20, 0xff, 0x28,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x16,
+  0x22, 0xff, 0xff, 0xff, 0xff, 0x20, 0x21, 0xff, 0x20, 0xff, 0x03, 0xff, 0x24, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x08, 0xff, 0xff, 0xff, 0xff, 0x12, 0x26, 0xff, 0x20, 0xff, 0x18, 0xff, 0x26, 0xff,
+  0x20, 0xff, 0x14, 0xff, 0xff, 0x14, 0x14, 0x26, 0xff, 0xff, 0x26, 0xff, 0x18, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x28, 0xff,
+  0x20, 0xff, 0x16, 0xff, 0x28, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0xff,
+  0x28, 0xff, 0x18, 0x28, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x12, 0xff, 0xff, 0x12, 0x20, 0x26,
+  0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x18, 0x26, 0xff, 0x18, 0xff, 0x18,
+  0xff, 0x26, 0xff, 0xff, 0x28, 0xff, 0x20, 0x22, 0xff, 0xff, 0xff, 0xff, 0x26, 0x21, 0xff, 0x20,
+  0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x20, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0x11, 0x21, 0xff, 0x20, 0xff, 0x18, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x11, 0xff, 0xff, 0x12, 0x24, 0x23, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff,
+  0x24, 0x10, 0x23, 0xff, 0x10, 0xff, 0x14, 0xff, 0x23, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff,
+  0x20, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x20, 0xff, 0x01, 0xff,
+  0xff, 0x14, 0x20, 0xff, 0xff, 0x11, 0x22, 0xff, 0x22, 0xff, 0x14, 0xff, 0x24, 0xff, 0x24, 0xff,
+  0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff, 0x14, 0xff, 0x14, 0x14, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x20, 0xff, 0x11, 0xff, 0xff, 0x13, 0x20, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x22, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x28, 0xff, 0x10, 0xff, 0x15, 0xff, 0x28,
+  0xff, 0x11, 0x23, 0xff, 0x20, 0xff, 0x18, 0xff, 0x0f, 0xff, 0x11, 0xff, 0x01, 0xff, 0xff, 0x18,
+  0x0f, 0x0f, 0xff, 0xff, 0x23, 0xff, 0x10, 0x23, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x01, 0xff,
+  0xff, 0x18, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x20, 0xff,
+  0xff, 0x20, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x15, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x21, 0xff, 0x20, 0xff, 0x05, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x24, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x24, 0x23, 0xff, 0x11, 0xff, 0xff, 0x13, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x14, 0x24,
+  0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x10, 0x11, 0xff, 0x10, 0xff, 0x14,
+  0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x23, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff,
+  0x18, 0x10, 0x28, 0xff, 0x11, 0xff, 0x01, 0xff, 0xff, 0x18, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0x28,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x11, 0x23, 0xff, 0x10, 0xff, 0x18, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0x01, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x0f, 0x20, 0xff, 0x01, 0xff, 0xff, 0x18, 0x0f, 0xff, 0xff, 0x11, 0x11, 0xff, 0x22, 0xff, 0x18,
+  0xff, 0x0f, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x0f, 0x0f, 0xff, 0xff, 0x11, 0xff, 0x10,
+  0x18, 0xff, 0xff, 0xff, 0xff, 0x20, 0x23, 0xff, 0x20, 0xff, 0x14, 0xff, 0x23, 0xff, 0x24, 0xff,
+  0x24, 0xff, 0xff, 0x24, 0x24, 0x23, 0xff, 0xff, 0x23, 0xff, 0x18, 0x23, 0xff, 0xff, 0xff, 0xff,
+  0x20, 0xff, 0x01, 0xff, 0xff, 0x12, 0x20, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x24, 0x20, 0xff, 0xff, 0x20, 0xff, 0x18, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x14, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0x24, 0x21, 0xff, 0x20, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x22, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x23, 0xff, 0x18, 0xff, 0x18, 0xff, 0x23,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x20, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x01, 0xff, 0xff, 0x18, 0x20, 0xff, 0xff, 0x22, 0x22, 0xff, 0x22,
+  0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28,
+  0xff, 0x18, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x13, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x21, 0xff, 0x20, 0xff, 0x03, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff,
+  0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0x18, 0xff, 0xff, 0xff, 0x20, 0xff, 0x01, 0xff, 0xff,
+  0x18, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0x18, 0x22, 0xff, 0xff, 0xff,
+  0xff, 0x28, 0x21, 0xff, 0x20, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0x08, 0x08, 0xff, 0x28, 0xff, 0x18, 0xff, 0x02, 0xff, 0x28, 0xff, 0x18, 0xff,
+  0xff, 0x18, 0x00, 0x04, 0xff, 0xff, 0x01, 0xff, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0x28, 0xff, 0x18, 0xff, 0x02, 0xff,
+  0x28, 0xff, 0x28, 0xff, 0x01, 0xff, 0xff, 0x03, 0x28, 0x28, 0xff, 0xff, 0x28, 0xff, 0x18, 0x28,
+  0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x25, 0x25, 0xff, 0xff, 0xff, 0x25,
+  0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0x25, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff,
+  0x28, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x28,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21,
+  0xff, 0x20, 0xff, 0x18, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0x28, 0xff, 0x28, 0xff,
+  0x02, 0xff, 0x02, 0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x28, 0x28, 0xff, 0xff, 0x01, 0xff,
+  0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24,
+  0xff, 0xff, 0x28, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x28, 0x21, 0xff, 0x20, 0xff, 0x0f,
+  0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x23, 0xff,
+  0xff, 0x23, 0x23, 0x23, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x23, 0xff, 0x23, 0x23, 0x23,
+  0xff, 0x23, 0xff, 0x23, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x28, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x28, 0xff, 0x28, 0xff, 0x0f, 0xff, 0xff,
+  0x0f, 0x28, 0x28, 0xff, 0xff, 0x28, 0xff, 0x00, 0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff,
+  0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x28, 0x21, 0xff, 0x20, 0xff, 0x28, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x00, 0xff, 0x02, 0xff, 0x0f,
+  0xff, 0x28, 0xff, 0x28, 0xff, 0xff, 0x28, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x08, 0xff, 0x18, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0x18, 0x21, 0xff, 0x20, 0xff, 0x18, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0x04,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x28, 0xff, 0x18, 0x22, 0xff, 0xff, 0xff, 0xff, 0x18, 0x21, 0xff, 0x20, 0xff, 0x03, 0xff, 0x28,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x28, 0xff, 0xff, 0xff, 0xff, 0x18, 0x28, 0xff, 0x18, 0xff, 0x18,
+  0xff, 0x28, 0xff, 0x18, 0xff, 0x18, 0xff, 0xff, 0x18, 0x18, 0x28, 0xff, 0xff, 0x28, 0xff, 0x18,
+  0x28, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+  0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x25, 0x20, 0xff, 0x01, 0xff, 0xff, 0x27, 0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x22, 0xff, 0x26, 0xff, 0xff, 0x26, 0x22, 0x24, 0xff,
+  0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0x16, 0x24, 0xff, 0x24, 0xff, 0x16, 0xff,
+  0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x20, 0xff, 0x01, 0xff, 0xff, 0x27,
+  0x20, 0xff, 0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0x12, 0x17, 0x17, 0xff, 0xff, 0xff, 0x25, 0xff,
+  0xff, 0xff, 0x25, 0xff, 0x25, 0x16, 0x26, 0xff, 0x16, 0xff, 0x16, 0xff, 0x03, 0xff, 0xff, 0xff,
+  0x11, 0xff, 0xff, 0xff, 0x17, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25,
+  0x26, 0xff, 0x01, 0xff, 0xff, 0x16, 0x00, 0x26, 0xff, 0x15, 0x15, 0xff, 0x15, 0xff, 0x02, 0xff,
+  0x02, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x25, 0x25, 0xff, 0xff, 0x01, 0xff, 0x00, 0x05,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+  0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x01, 0xff,
+  0xff, 0x16, 0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0x01, 0xff, 0xff, 0x16, 0x00, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x0f, 0x22, 0xff, 0x22, 0xff,
+  0xff, 0x22, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x16,
+  0xff, 0x16, 0xff, 0x16, 0xff, 0x06, 0xff, 0x24, 0xff, 0x13, 0xff, 0xff, 0x27, 0x26, 0x24, 0xff,
+  0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x24, 0xff, 0x26, 0x26, 0x24, 0xff, 0x24, 0xff, 0x27, 0xff,
+  0x24, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x26, 0x20, 0xff, 0x11, 0xff, 0xff, 0x27, 0x20, 0x24, 0xff, 0x24, 0x24, 0xff,
+  0x24, 0xff, 0x02, 0xff, 0x24, 0xff, 0x24, 0xff, 0x01, 0xff, 0xff, 0x04, 0x24, 0x24, 0xff, 0xff,
+  0x24, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x20, 0xff, 0x11, 0xff, 0xff, 0x27,
+  0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0xff,
+  0x26, 0xff, 0xff, 0x27, 0x20, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x20, 0xff, 0x26,
+  0x20, 0xff, 0xff, 0x20, 0xff, 0x27, 0xff, 0xff, 0xff, 0x13, 0x13, 0xff, 0x13, 0xff, 0x13, 0xff,
+  0x02, 0xff, 0x13, 0xff, 0x13, 0xff, 0xff, 0x13, 0x00, 0x03, 0xff, 0xff, 0x01, 0xff, 0x00, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x11, 0xff, 0xff, 0x12, 0x17, 0x26, 0xff, 0xff, 0xff, 0x11,
+  0xff, 0xff, 0xff, 0x17, 0xff, 0x17, 0x26, 0x26, 0xff, 0x26, 0xff, 0x16, 0xff, 0x26, 0xff, 0xff,
+  0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff,
+  0xff, 0xff, 0x27, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x27, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0x27, 0xff, 0x27, 0xff, 0xff, 0x27, 0x27, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x27, 0xff,
+  0xff, 0xff, 0x27, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x27, 0xff,
+  0x27, 0xff, 0xff, 0x27, 0x27, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x0f, 0x27, 0xff, 0x27, 0xff, 0xff, 0x27, 0x27, 0x27, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff,
+  0xff, 0x25, 0xff, 0x25, 0x27, 0x27, 0xff, 0x27, 0xff, 0x27, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x27, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x27, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0x27, 0xff, 0xff, 0x27, 0x27, 0x27, 0xff,
+  0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x27, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0x27, 0xff, 0x27, 0xff, 0xff, 0x27, 0x27, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x27, 0xff, 0x27, 0xff, 0xff, 0x27, 0x27, 0x24, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x27, 0x24, 0xff, 0x27, 0xff, 0x27, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x20, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x27, 0xff, 0xff, 0x27, 0x20,
+  0xff, 0xff, 0x27, 0xff, 0x27, 0xff, 0xff, 0x27, 0x27, 0x23, 0xff, 0xff, 0xff, 0x27, 0xff, 0xff,
+  0xff, 0x27, 0xff, 0x27, 0x27, 0x23, 0xff, 0x27, 0xff, 0x27, 0xff, 0x23, 0xff, 0xff, 0xff, 0x27,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x27, 0x20,
+  0xff, 0x27, 0xff, 0xff, 0x27, 0x20, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x03, 0xff, 0xff, 0x13, 0x12, 0x24, 0xff, 0xff, 0xff, 0x25, 0xff,
+  0xff, 0xff, 0x25, 0xff, 0x25, 0x04, 0x24, 0xff, 0x24, 0xff, 0x03, 0xff, 0x24, 0xff, 0xff, 0xff,
+  0x25, 0xff, 0xff, 0xff, 0x24, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25,
+  0x24, 0xff, 0x01, 0xff, 0xff, 0x24, 0x00, 0x24, 0xff, 0x00, 0x24, 0xff, 0x20, 0xff, 0x0f, 0xff,
+  0x24, 0xff, 0x25, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x25, 0x24, 0xff, 0xff, 0x24, 0xff, 0x00, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x20, 0xff, 0x02, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x20, 0xff, 0x01, 0xff, 0xff, 0x27, 0x20, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f,
+  0x20, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0xff, 0xff, 0x20,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0x12, 0x22, 0xff, 0x22, 0xff, 0x02, 0xff, 0x02, 0xff, 0x25, 0xff,
+  0x25, 0xff, 0xff, 0x25, 0x25, 0x25, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0x12, 0xff, 0x12, 0xff, 0xff, 0x12, 0x00, 0x02, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x25,
+  0xff, 0x25, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0x25, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x01, 0xff, 0xff, 0x03, 0x00, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x0f, 0x22, 0xff, 0x0f, 0xff,
+  0xff, 0x0f, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x24,
+  0xff, 0x00, 0xff, 0x0f, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0x20, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x22, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x22, 0x22,
+  0xff, 0x22, 0xff, 0x0f, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x13, 0x24, 0xff, 0x20, 0xff, 0x13, 0xff,
+  0x24, 0xff, 0x20, 0xff, 0x13, 0xff, 0xff, 0x13, 0x13, 0x24, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x12, 0x12, 0x24, 0xff, 0xff, 0xff, 0x11,
+  0xff, 0xff, 0xff, 0x10, 0xff, 0x14, 0x14, 0x24, 0xff, 0x24, 0xff, 0x14, 0xff, 0x24, 0xff, 0xff,
+  0x24, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x13, 0xff, 0xff, 0x27,
+  0x20, 0xff, 0xff, 0xff, 0xff, 0x13, 0xff, 0xff, 0xff, 0x20, 0xff, 0x13, 0x20, 0xff, 0xff, 0x20,
+  0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x12, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0x20, 0xff, 0x11, 0xff, 0xff, 0x27, 0x20, 0xff, 0xff,
+  0x20, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x20,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0x13, 0x21, 0xff, 0x20, 0xff, 0x13, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x12, 0x12, 0xff, 0x12, 0xff, 0x12, 0xff, 0x02, 0xff, 0x10,
+  0xff, 0x11, 0xff, 0xff, 0x17, 0x17, 0x17, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x25, 0x26, 0xff, 0x26, 0xff, 0xff, 0x24, 0x26, 0x24, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff,
+  0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25,
+  0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff,
+  0xff, 0x26, 0xff, 0x0f, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0xff, 0xff, 0x25,
+  0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0x26, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26,
+  0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x26, 0x26, 0xff, 0x26, 0xff, 0xff, 0x24, 0x26, 0x24, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x0f, 0x26, 0xff, 0x26, 0xff, 0xff, 0x24, 0x26, 0x24,
+  0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x26, 0x24, 0xff, 0x24, 0xff, 0x24,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x20, 0xff, 0x21, 0xff, 0xff,
+  0xff, 0x20, 0xff, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0xff, 0xff, 0x26,
+  0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x26, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff,
+  0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x26, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x03, 0xff, 0xff, 0xff, 0x10, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25,
+  0x24, 0xff, 0x01, 0xff, 0xff, 0x24, 0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0x0f, 0x00, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x24, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0x25, 0xff, 0x0f, 0x00, 0x24, 0xff, 0x24, 0xff, 0x0f, 0xff, 0x24, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff,
+  0x12, 0xff, 0x01, 0xff, 0xff, 0x02, 0x12, 0x12, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x25,
+  0xff, 0x25, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff,
+  0xff, 0x12, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x0f, 0xff, 0x0f,
+  0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0x00, 0x01, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x02, 0xff, 0x25,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0x25, 0x25, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x22, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00,
+  0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0x20, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x22, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x22,
+  0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff,
+  0x0f, 0xff, 0x0f, 0xff, 0x24, 0xff, 0x03, 0xff, 0xff, 0x24, 0x00, 0x24, 0xff, 0xff, 0xff, 0x13,
+  0xff, 0xff, 0xff, 0x10, 0xff, 0x13, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff,
+  0xff, 0x11, 0xff, 0xff, 0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x14, 0x24, 0xff, 0x01, 0xff, 0xff, 0x24, 0x00, 0x24, 0xff, 0x00, 0x24, 0xff, 0x24, 0xff, 0x0f,
+  0xff, 0x24, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x24, 0xff, 0xff, 0x24, 0xff, 0x24,
+  0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x02, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x13, 0x20, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x00, 0xff, 0x02, 0xff, 0x02, 0xff, 0x13,
+  0xff, 0x13, 0xff, 0xff, 0x13, 0x13, 0x13, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0x12, 0xff, 0x12, 0xff, 0xff, 0x12, 0x12, 0x12, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff,
+  0x10, 0xff, 0x1f, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x11, 0xff, 0xff, 0x12, 0x24, 0x24, 0xff,
+  0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0x11, 0x24, 0xff, 0x10, 0xff, 0x13, 0xff,
+  0x24, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x24, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x25, 0x20, 0xff, 0x11, 0xff, 0xff, 0x14, 0x00, 0x24, 0xff, 0x22, 0x24, 0xff,
+  0x20, 0xff, 0x16, 0xff, 0x24, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x25, 0x24, 0xff, 0xff,
+  0x24, 0xff, 0x14, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x20, 0xff, 0x11, 0xff, 0xff, 0x13,
+  0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0xff,
+  0x16, 0xff, 0xff, 0x16, 0x20, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x20, 0xff, 0x25,
+  0x20, 0xff, 0xff, 0x20, 0xff, 0x16, 0xff, 0xff, 0xff, 0x11, 0x11, 0xff, 0x22, 0xff, 0x12, 0xff,
+  0x0f, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x0f, 0x0f, 0xff, 0xff, 0x01, 0xff, 0x16, 0x16,
+  0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x11, 0xff, 0xff, 0x12, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0x25,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x00, 0x26, 0xff, 0x16, 0xff, 0x16, 0xff, 0x0f, 0xff, 0xff,
+  0x01, 0xff, 0x15, 0x22, 0xff, 0xff, 0xff, 0xff, 0x25, 0x21, 0xff, 0x20, 0xff, 0x25, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff,
+  0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x01, 0xff,
+  0xff, 0x13, 0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x0f,
+  0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x24, 0xff, 0x10, 0xff, 0x16, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x20, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x01, 0xff, 0xff, 0x16, 0x20, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff,
+  0xff, 0x22, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01,
+  0xff, 0x16, 0xff, 0x16, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x16, 0x0f,
+  0x0f, 0xff, 0x22, 0x22, 0xff, 0x22, 0xff, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x16, 0x16, 0xff, 0xff, 0xff, 0xff, 0x11, 0x24, 0xff,
+  0x20, 0xff, 0x13, 0xff, 0x24, 0xff, 0x20, 0xff, 0x13, 0xff, 0xff, 0x13, 0x24, 0x24, 0xff, 0xff,
+  0x24, 0xff, 0x13, 0x24, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x11, 0xff, 0xff, 0x12, 0x14, 0x24,
+  0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x24, 0xff, 0x14, 0x20, 0x24, 0xff, 0x20, 0xff, 0x14,
+  0xff, 0x24, 0xff, 0xff, 0x24, 0xff, 0x14, 0x22, 0xff, 0xff, 0xff, 0xff, 0x24, 0x21, 0xff, 0x20,
+  0xff, 0x04, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0x11, 0xff, 0xff, 0x12, 0x20, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x20, 0xff, 0x26,
+  0x20, 0xff, 0xff, 0x20, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x20, 0xff, 0x11, 0xff, 0xff,
+  0x16, 0x20, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0x16, 0xff, 0xff, 0xff, 0x20, 0xff, 0x26,
+  0xff, 0xff, 0x26, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0xff, 0x13, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x13, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x11, 0x26, 0xff, 0x20, 0xff, 0x12,
+  0xff, 0x0f, 0xff, 0x11, 0xff, 0x11, 0xff, 0xff, 0x16, 0x0f, 0x0f, 0xff, 0xff, 0x26, 0xff, 0x16,
+  0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x24, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0x20, 0xff, 0x11, 0xff, 0xff, 0x13, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x24, 0x24, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x11, 0x24, 0xff, 0x10, 0xff, 0x14, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x20, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x11, 0xff, 0xff, 0x15, 0x20,
+  0xff, 0xff, 0x11, 0xff, 0x11, 0xff, 0xff, 0x12, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0x11, 0x23, 0xff, 0x10, 0xff, 0x13, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x11,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x20,
+  0xff, 0x11, 0xff, 0xff, 0x15, 0x0f, 0xff, 0xff, 0x00, 0x01, 0xff, 0x15, 0xff, 0x15, 0xff, 0x0f,
+  0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x0f, 0x0f, 0xff, 0xff, 0x01, 0xff, 0x15, 0x15, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff,
+  0x14, 0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff,
+  0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x11, 0xff, 0xff, 0x13, 0x0f, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x22, 0xff, 0x22, 0xff, 0xff,
+  0x22, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x11, 0xff,
+  0x10, 0xff, 0x1f, 0xff, 0x0f, 0xff, 0x20, 0xff, 0x11, 0xff, 0xff, 0x12, 0x24, 0x23, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x20, 0x23, 0xff, 0x20, 0xff, 0x13, 0xff, 0x23,
+  0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x24, 0x20, 0xff, 0x11, 0xff, 0xff, 0x14, 0x20, 0xff, 0xff, 0x24, 0x24, 0xff, 0x24,
+  0xff, 0x14, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff, 0x24,
+  0xff, 0x14, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x20, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x11, 0xff, 0xff, 0x13, 0x20,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0xff, 0x22,
+  0xff, 0xff, 0x22, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0xff, 0x20, 0xff, 0x1f, 0xff, 0xff, 0xff, 0x00, 0x23, 0xff, 0x13, 0xff, 0x13, 0xff, 0x0f,
+  0xff, 0x00, 0xff, 0x01, 0xff, 0xff, 0x13, 0x0f, 0x0f, 0xff, 0xff, 0x23, 0xff, 0x13, 0x23, 0xff,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x11, 0xff, 0xff, 0x12, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff,
+  0xff, 0xff, 0x0f, 0xff, 0x0f, 0x20, 0xff, 0xff, 0x20, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x22, 0x24, 0xff, 0x20, 0xff, 0x13, 0xff,
+  0x24, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x25, 0x24, 0xff, 0xff, 0x24, 0xff, 0x14, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x25, 0xff, 0xff, 0x25, 0x24, 0x24, 0xff, 0xff, 0xff, 0x25,
+  0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0x24, 0x24, 0xff, 0x24, 0xff, 0x14, 0xff, 0x24, 0xff, 0xff,
+  0x24, 0xff, 0x20, 0x22, 0xff, 0xff, 0xff, 0xff, 0x25, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x13, 0xff, 0xff, 0x13,
+  0x20, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x20, 0xff, 0x25, 0x20, 0xff, 0xff, 0x20,
+  0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x20, 0xff, 0x25, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x20, 0xff, 0x25, 0xff, 0xff, 0x25, 0x20, 0xff, 0xff,
+  0x20, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x20,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x22, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0x25, 0x21, 0xff, 0x20, 0xff, 0x25, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x22, 0xff, 0x12, 0xff, 0x0f, 0xff, 0x25,
+  0xff, 0x25, 0xff, 0xff, 0x25, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff,
+  0xff, 0x22, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x24,
+  0xff, 0x24, 0xff, 0x03, 0xff, 0x24, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24,
+  0x24, 0xff, 0x22, 0x22, 0xff, 0x22, 0xff, 0x0f, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x00, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x23, 0xff, 0xff, 0x23, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x22, 0x22,
+  0xff, 0x22, 0xff, 0x22, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x0f,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff,
+  0x0f, 0xff, 0x0f, 0xff, 0xff, 0x22, 0xff, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x24, 0xff, 0x20, 0x22, 0xff, 0xff, 0xff, 0xff, 0x20, 0x21, 0xff, 0x20, 0xff, 0x13, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0x11, 0x24, 0xff, 0x20, 0xff, 0x12,
+  0xff, 0x24, 0xff, 0x20, 0xff, 0x11, 0xff, 0xff, 0x14, 0x14, 0x24, 0xff, 0xff, 0x24, 0xff, 0x14,
+  0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+  0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x20, 0xff, 0xff, 0x20, 0xff, 0x13, 0xff, 0xff, 0xff, 0x20, 0xff, 0x13, 0xff, 0xff, 0x13, 0x20,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x11, 0xff, 0xff,
+  0x12, 0x20, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0xff, 0xff, 0x20, 0xff, 0x1f, 0x20, 0xff, 0xff,
+  0x20, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x12,
+  0x22, 0xff, 0xff, 0xff, 0xff, 0x11, 0x21, 0xff, 0x20, 0xff, 0x1f, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x14, 0x22, 0xff, 0x22, 0xff, 0x14, 0xff, 0x14, 0xff, 0x20, 0xff, 0x04, 0xff, 0xff,
+  0x24, 0x14, 0x26, 0xff, 0xff, 0x05, 0xff, 0x05, 0x05, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x14,
+  0xff, 0xff, 0x24, 0x14, 0x26, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x05,
+  0x26, 0xff, 0x05, 0xff, 0x04, 0xff, 0x26, 0xff, 0xff, 0x12, 0xff, 0x14, 0x22, 0xff, 0xff, 0xff,
+  0xff, 0x10, 0x21, 0xff, 0x20, 0xff, 0x04, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff,
+  0xff, 0xff, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x27, 0x10, 0x23, 0xff, 0xff, 0xff, 0x26, 0xff,
+  0xff, 0xff, 0x26, 0xff, 0x26, 0x15, 0x15, 0xff, 0x27, 0xff, 0x27, 0xff, 0x15, 0xff, 0xff, 0xff,
+  0x25, 0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25,
+  0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x25, 0x25, 0xff, 0x10, 0x21, 0xff, 0x27, 0xff, 0x27, 0xff,
+  0x12, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0xff, 0x15, 0xff, 0x27, 0x27,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x10, 0x21, 0xff,
+  0x20, 0xff, 0x0f, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0x26, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x26, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x26,
+  0xff, 0xff, 0x26, 0xff, 0x00, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x14, 0xff, 0xff, 0x24, 0x14, 0x23, 0xff, 0xff, 0xff,
+  0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x14, 0x23, 0xff, 0x24, 0xff, 0x24, 0xff, 0x23, 0xff,
+  0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0x10, 0x11, 0xff, 0x10, 0xff,
+  0x02, 0xff, 0x14, 0xff, 0x10, 0xff, 0x01, 0xff, 0xff, 0x04, 0x00, 0x14, 0xff, 0xff, 0x14, 0xff,
+  0x14, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x23, 0xff, 0x23, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0x23, 0xff, 0x23, 0xff, 0xff, 0x23, 0x23, 0x23,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x16, 0xff,
+  0xff, 0x27, 0x10, 0x12, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x10, 0x11,
+  0xff, 0x27, 0xff, 0x27, 0xff, 0x16, 0xff, 0x00, 0x11, 0xff, 0x10, 0xff, 0x0f, 0xff, 0x17, 0xff,
+  0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x17, 0xff, 0xff, 0x16, 0xff, 0x00, 0x16, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x26, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0x00, 0xff, 0x0f, 0x00, 0x26, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x26, 0xff, 0xff, 0x11, 0xff,
+  0x10, 0x22, 0xff, 0xff, 0xff, 0xff, 0x10, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x17, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0x22, 0xff, 0xff, 0xff,
+  0xff, 0x20, 0x21, 0xff, 0x20, 0xff, 0x24, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0x12, 0x26, 0xff, 0x22, 0xff, 0x02, 0xff, 0x26, 0xff, 0x20, 0xff, 0x14, 0xff,
+  0xff, 0x24, 0x26, 0x26, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0x22, 0xff, 0x27, 0xff, 0x27, 0xff,
+  0x12, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x12, 0xff, 0xff, 0x27, 0x12, 0x26, 0xff, 0xff, 0xff, 0x26,
+  0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+  0x22, 0xff, 0x27, 0x22, 0xff, 0xff, 0xff, 0xff, 0x26, 0x21, 0xff, 0x20, 0xff, 0x26, 0xff, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x20, 0x21,
+  0xff, 0x20, 0xff, 0x0f, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x04, 0xff, 0xff,
+  0x24, 0x10, 0x23, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x05, 0x23, 0xff,
+  0x15, 0xff, 0x03, 0xff, 0x23, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0x02, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x20, 0xff, 0x01, 0xff, 0xff, 0x04, 0x20, 0xff,
+  0xff, 0x14, 0x22, 0xff, 0x22, 0xff, 0x24, 0xff, 0x14, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24,
+  0x24, 0x24, 0xff, 0xff, 0x15, 0xff, 0x15, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff,
+  0x01, 0xff, 0xff, 0x27, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x0f, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x15, 0x15, 0xff, 0x27, 0xff, 0x27, 0xff, 0x15, 0xff, 0x10, 0x23, 0xff,
+  0x20, 0xff, 0x0f, 0xff, 0x23, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x23, 0xff, 0xff,
+  0x23, 0xff, 0x00, 0x23, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x20, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x20, 0xff, 0xff, 0x20, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20,
+  0xff, 0x0f, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x24, 0xff, 0xff, 0xff, 0x23, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24,
+  0x23, 0xff, 0x01, 0xff, 0xff, 0x24, 0x10, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff,
+  0xff, 0x20, 0xff, 0x0f, 0x10, 0xff, 0x14, 0xff, 0xff, 0x24, 0x10, 0x12, 0xff, 0xff, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x10, 0x11, 0xff, 0x10, 0xff, 0x14, 0xff, 0x14, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x23, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x11, 0xff, 0xff, 0x27, 0x10, 0x17, 0xff,
+  0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x23, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x00,
+  0xff, 0x0f, 0x10, 0x23, 0xff, 0x10, 0xff, 0x0f, 0xff, 0x23, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x20, 0xff, 0x0f,
+  0xff, 0xff, 0x0f, 0x20, 0xff, 0xff, 0x10, 0x11, 0xff, 0x10, 0xff, 0x0f, 0xff, 0x17, 0xff, 0x10,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x17, 0xff, 0xff, 0x11, 0xff, 0x10, 0x17, 0xff, 0xff, 0xff,
+  0xff, 0x02, 0x23, 0xff, 0x22, 0xff, 0x02, 0xff, 0x23, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24,
+  0x24, 0x23, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x01, 0xff,
+  0xff, 0x02, 0x20, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0x24, 0x0f, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0x24, 0x21, 0xff, 0x20, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0x22, 0x22, 0xff, 0x22, 0xff, 0x22, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20,
+  0xff, 0x0f, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x20, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0x07, 0x22, 0xff, 0xff, 0xff, 0xff, 0x07, 0x21, 0xff,
+  0x20, 0xff, 0x03, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0x07,
+  0x07, 0xff, 0x07, 0xff, 0x02, 0xff, 0x07, 0xff, 0x17, 0xff, 0x01, 0xff, 0xff, 0x04, 0x17, 0x17,
+  0xff, 0xff, 0x01, 0xff, 0x00, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0x17, 0xff, 0x27, 0xff, 0x27, 0xff, 0x17, 0xff, 0x17, 0xff,
+  0x01, 0xff, 0xff, 0x27, 0x17, 0x17, 0xff, 0xff, 0x01, 0xff, 0x27, 0x27, 0xff, 0xff, 0xff, 0xff,
+  0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x25, 0x25, 0xff, 0xff, 0xff, 0x25, 0xff, 0xff, 0xff, 0x25,
+  0xff, 0x25, 0x25, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x17, 0xff, 0x27, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x01, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x0f,
+  0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x17, 0xff, 0x07, 0xff, 0x02, 0xff, 0x17, 0xff,
+  0x07, 0xff, 0x01, 0xff, 0xff, 0x03, 0x07, 0x17, 0xff, 0xff, 0x01, 0xff, 0x00, 0x03, 0xff, 0xff,
+  0xff, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0x24, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x17, 0xff,
+  0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x17, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x23, 0xff, 0xff, 0x23, 0x23, 0x23,
+  0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x23, 0xff, 0x23, 0x23, 0x23, 0xff, 0x23, 0xff, 0x23,
+  0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x17,
+  0xff, 0x27, 0xff, 0x0f, 0xff, 0x17, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x17, 0xff,
+  0xff, 0x17, 0xff, 0x27, 0x27, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x02, 0xff, 0x00, 0xff, 0x0f,
+  0xff, 0xff, 0x0f, 0x00, 0x17, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x17, 0x21,
+  0xff, 0x20, 0xff, 0x04, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x27, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0x17, 0x21, 0xff, 0x20, 0xff, 0x27, 0xff, 0x17, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0x27, 0xff, 0x27, 0xff, 0x02, 0xff, 0x17,
+  0xff, 0x17, 0xff, 0xff, 0x27, 0x17, 0x17, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x14,
+  0xff, 0xff, 0x24, 0x10, 0x12, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x10, 0xff, 0x14, 0x05,
+  0x15, 0xff, 0x24, 0xff, 0x24, 0xff, 0x15, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x10, 0xff,
+  0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x05, 0xff, 0x01, 0xff, 0xff, 0x24,
+  0x00, 0x26, 0xff, 0x14, 0x21, 0xff, 0x24, 0xff, 0x24, 0xff, 0x12, 0xff, 0x21, 0xff, 0x01, 0xff,
+  0xff, 0x24, 0x10, 0x14, 0xff, 0xff, 0x15, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x21, 0xff, 0xff, 0xff, 0x10, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26,
+  0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff,
+  0xff, 0x25, 0xff, 0x0f, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x10, 0x12, 0xff, 0xff, 0xff, 0x21,
+  0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x21, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0x00,
+  0x12, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x12, 0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x10, 0x13,
+  0xff, 0xff, 0x01, 0xff, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f,
+  0x10, 0x26, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0xff, 0x0f, 0x00, 0x26, 0xff, 0x00,
+  0xff, 0x0f, 0xff, 0x26, 0xff, 0xff, 0x15, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21,
+  0xff, 0x20, 0xff, 0x0f, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x10, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x24, 0x24, 0xff, 0x01, 0xff, 0xff, 0x24, 0x10, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0x24, 0xff, 0x0f, 0x10, 0xff, 0x01, 0xff, 0xff, 0x24, 0x10, 0x12, 0xff, 0xff,
+  0xff, 0x01, 0xff, 0xff, 0xff, 0x10, 0xff, 0x04, 0x10, 0x11, 0xff, 0x24, 0xff, 0x24, 0xff, 0x14,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x23, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x10, 0xff, 0x02,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x10,
+  0x16, 0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x10, 0x12, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0x10, 0xff, 0x0f, 0x00, 0x16, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x16, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x26, 0xff, 0x10, 0x11, 0xff, 0x10, 0xff, 0x0f, 0xff, 0x12,
+  0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x10, 0x16, 0xff, 0xff, 0x16, 0xff, 0x00, 0x16, 0xff,
+  0xff, 0xff, 0xff, 0x02, 0x22, 0xff, 0x24, 0xff, 0x24, 0xff, 0x12, 0xff, 0x21, 0xff, 0x24, 0xff,
+  0xff, 0x24, 0x10, 0x26, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0x01, 0xff, 0xff, 0x24, 0x12, 0x26, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x26, 0xff, 0x14,
+  0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x01, 0xff, 0x24, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0x24, 0x21, 0xff, 0x20, 0xff, 0x24, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x12, 0x12, 0xff, 0xff, 0xff, 0x21,
+  0xff, 0xff, 0xff, 0x26, 0xff, 0x26, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0x21, 0xff, 0xff, 0xff, 0x12, 0xff, 0x12, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x26, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x21, 0x21, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x12, 0xff, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x26, 0x26, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21,
+  0xff, 0x20, 0xff, 0x0f, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0x00, 0x26, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x26, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x10,
+  0x26, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x10, 0xff, 0x02, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x05, 0xff, 0x01, 0xff, 0xff, 0x24, 0x00, 0x23,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x24, 0xff, 0x24, 0xff,
+  0xff, 0x24, 0x00, 0x12, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x05, 0x15,
+  0xff, 0x24, 0xff, 0x24, 0xff, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x00,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x21,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+  0xff, 0x21, 0xff, 0xff, 0xff, 0x00, 0x15, 0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x10, 0x23,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0xff, 0x0f, 0x00, 0x23, 0xff, 0x00, 0xff, 0x0f,
+  0xff, 0x23, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x20, 0xff, 0xff, 0x00, 0x15,
+  0xff, 0x00, 0xff, 0x0f, 0xff, 0x15, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x15, 0xff,
+  0xff, 0x15, 0xff, 0x00, 0x15, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+  0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0x10, 0xff, 0x02, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x24, 0x10, 0xff, 0x01, 0xff, 0xff, 0x24, 0x10, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x10, 0xff, 0x0f,
+  0xff, 0xff, 0x0f, 0x10, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0x0f, 0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x10, 0x12, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0x10, 0xff, 0x0f, 0x10, 0x11, 0xff, 0x10, 0xff, 0x0f, 0xff, 0x1f, 0xff, 0x02, 0xff, 0x01, 0xff,
+  0xff, 0x24, 0x02, 0x23, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x0f, 0x0f,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff, 0xff, 0x20, 0xff, 0x02,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f,
+  0xff, 0xff, 0x00, 0x01, 0xff, 0x24, 0xff, 0x24, 0xff, 0x02, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff,
+  0x24, 0x24, 0x24, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+  0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0x0f, 0xff, 0x0f, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x00, 0x23,
+  0xff, 0x00, 0xff, 0x0f, 0xff, 0x23, 0xff, 0x00, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x23, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x20,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0xff,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff,
+  0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x14,
+  0x21, 0xff, 0x24, 0xff, 0x24, 0xff, 0x12, 0xff, 0x21, 0xff, 0x01, 0xff, 0xff, 0x24, 0x10, 0x13,
+  0xff, 0xff, 0x01, 0xff, 0x24, 0x24, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24,
+  0x12, 0x12, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x10, 0xff, 0x14, 0x00, 0x01, 0xff, 0x24,
+  0xff, 0x24, 0xff, 0x04, 0xff, 0xff, 0x21, 0xff, 0x24, 0x22, 0xff, 0xff, 0xff, 0xff, 0x10, 0x21,
+  0xff, 0x20, 0xff, 0x0f, 0xff, 0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff,
+  0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x10, 0x12, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x10,
+  0xff, 0x13, 0x21, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff,
+  0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x21, 0xff, 0x21,
+  0xff, 0xff, 0xff, 0x25, 0x25, 0xff, 0x21, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x21,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0x15, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x12, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x10, 0x21, 0xff, 0x20, 0xff, 0x0f,
+  0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x12, 0xff, 0x00,
+  0xff, 0x0f, 0xff, 0x12, 0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x10, 0x15, 0xff, 0xff, 0x0f,
+  0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x24, 0xff, 0x01, 0xff, 0xff, 0x24, 0x10, 0x12, 0xff, 0xff, 0xff, 0x01, 0xff, 0xff,
+  0xff, 0x10, 0xff, 0x03, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x14, 0xff, 0xff, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x24, 0x24,
+  0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0x10, 0x21, 0xff, 0x24, 0xff, 0x0f, 0xff, 0x12,
+  0xff, 0x10, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x10, 0x14, 0xff, 0xff, 0x14, 0xff, 0x24, 0x24, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff, 0x23, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x23, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x23, 0x23, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10,
+  0x12, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0xff, 0x0f, 0x21, 0x21, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x1f, 0xff, 0x00, 0x12, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x12, 0xff, 0x10, 0xff, 0x0f,
+  0xff, 0xff, 0x0f, 0x10, 0x13, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0x00, 0x12, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x10, 0xff,
+  0x0f, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x12, 0xff, 0x00, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0x10, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x24, 0x22, 0xff, 0xff, 0xff, 0xff, 0x21, 0x21,
+  0xff, 0x20, 0xff, 0x24, 0xff, 0x13, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0x12, 0x12, 0xff, 0x24, 0xff, 0x24, 0xff, 0x12, 0xff, 0x21, 0xff, 0x14, 0xff, 0xff, 0x24, 0x10,
+  0x14, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0x12, 0xff, 0x21,
+  0xff, 0x21, 0xff, 0xff, 0xff, 0x10, 0x13, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x21, 0xff, 0x21, 0xff, 0xff, 0xff, 0x12, 0x12, 0xff, 0xff, 0xff, 0x21, 0xff, 0xff, 0xff,
+  0x10, 0xff, 0x1f, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x21, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0x21, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x12, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x10, 0x21, 0xff, 0x20, 0xff,
+  0x0f, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x16, 0x22, 0xff, 0xff, 0xff,
+  0xff, 0x06, 0x21, 0xff, 0x20, 0xff, 0x03, 0xff, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff,
+  0xff, 0xff, 0xff, 0x26, 0x26, 0xff, 0x26, 0xff, 0x02, 0xff, 0x26, 0xff, 0x26, 0xff, 0x01, 0xff,
+  0xff, 0x04, 0x00, 0x26, 0xff, 0xff, 0x26, 0xff, 0x00, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0x26, 0xff, 0x16, 0xff, 0x16, 0xff,
+  0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0xff, 0x01, 0xff, 0x00, 0x03,
+  0xff, 0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff, 0x25, 0x25, 0x25, 0xff, 0xff, 0xff, 0x25,
+  0xff, 0xff, 0xff, 0x25, 0xff, 0x25, 0x25, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0x25, 0xff, 0xff,
+  0x16, 0xff, 0x16, 0x22, 0xff, 0xff, 0xff, 0xff, 0x26, 0x21, 0xff, 0x20, 0xff, 0x26, 0xff, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21,
+  0xff, 0x20, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x06, 0x26, 0xff, 0x26, 0xff,
+  0x02, 0xff, 0x02, 0xff, 0x06, 0xff, 0x01, 0xff, 0xff, 0x03, 0x00, 0x03, 0xff, 0xff, 0x16, 0xff,
+  0x16, 0x16, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x24, 0x24, 0xff, 0x24, 0xff, 0x24, 0xff, 0x24,
+  0xff, 0xff, 0x16, 0xff, 0x16, 0x22, 0xff, 0xff, 0xff, 0xff, 0x06, 0x21, 0xff, 0x20, 0xff, 0x04,
+  0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x23, 0xff,
+  0xff, 0x23, 0x23, 0x23, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0x23, 0xff, 0x23, 0x23, 0x23,
+  0xff, 0x23, 0xff, 0x23, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x16, 0x16, 0xff, 0x16, 0xff, 0x16, 0xff, 0x16, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff,
+  0x26, 0x26, 0x26, 0xff, 0xff, 0x16, 0xff, 0x16, 0x16, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0xff,
+  0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x16, 0xff, 0xff, 0xff, 0xff, 0x00, 0x26, 0xff, 0x00, 0xff, 0x0f, 0xff, 0x0f,
+  0xff, 0x00, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0x26, 0xff, 0x00, 0x26, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x26, 0xff, 0x00, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0x26, 0x21, 0xff, 0x20, 0xff, 0x04, 0xff, 0x26, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x01, 0xff, 0x00, 0x22, 0xff, 0xff, 0xff, 0xff, 0x26, 0x21, 0xff, 0x20, 0xff, 0x26, 0xff, 0x26,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x00, 0x26, 0xff, 0x00, 0xff, 0x02,
+  0xff, 0x26, 0xff, 0x26, 0xff, 0x26, 0xff, 0xff, 0x26, 0x26, 0x26, 0xff, 0xff, 0x0f, 0xff, 0x0f,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21,
+  0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x20, 0x23, 0xff, 0x20, 0xff, 0x14, 0xff, 0x23, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24,
+  0x24, 0x23, 0xff, 0xff, 0x23, 0xff, 0x15, 0x23, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0x24, 0xff,
+  0xff, 0x24, 0x20, 0xff, 0xff, 0xff, 0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0x24, 0x20, 0xff,
+  0xff, 0x20, 0xff, 0x04, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0x24, 0x21, 0xff, 0x20, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0xff,
+  0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff, 0x22, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x15, 0x23, 0xff, 0x15, 0xff, 0x15, 0xff, 0x23, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20,
+  0xff, 0x25, 0xff, 0xff, 0x25, 0x20, 0xff, 0xff, 0x22, 0x22, 0xff, 0x22, 0xff, 0x22, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x15, 0xff, 0x15, 0x15, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x20, 0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff,
+  0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x23, 0xff, 0xff, 0xff, 0x24,
+  0xff, 0xff, 0xff, 0x24, 0xff, 0x24, 0x23, 0x23, 0xff, 0x23, 0xff, 0x14, 0xff, 0x23, 0xff, 0xff,
+  0xff, 0x24, 0xff, 0xff, 0xff, 0x20, 0xff, 0x24, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x24, 0x20, 0xff, 0x24, 0xff, 0xff, 0x24, 0x20, 0xff, 0xff, 0x10, 0x22, 0xff, 0x22, 0xff, 0x14,
+  0xff, 0x14, 0xff, 0x24, 0xff, 0x24, 0xff, 0xff, 0x24, 0x24, 0x24, 0xff, 0xff, 0x11, 0xff, 0x10,
+  0x14, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x23, 0xff, 0xff, 0x23, 0x23, 0x23, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0x22, 0xff, 0xff,
+  0x22, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x10, 0x11, 0xff,
+  0x10, 0xff, 0x1f, 0xff, 0x1f, 0xff, 0x00, 0x23, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x00,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0x23, 0xff, 0x10, 0x23, 0xff, 0xff, 0xff,
+  0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0x0f, 0xff, 0x0f, 0x20, 0xff, 0xff, 0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x11, 0xff, 0x10,
+  0x22, 0xff, 0xff, 0xff, 0xff, 0x00, 0x21, 0xff, 0x20, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x23, 0xff, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff,
+  0x24, 0x21, 0xff, 0x20, 0xff, 0x24, 0xff, 0x23, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0x20, 0xff, 0xff, 0x20, 0xff, 0x02, 0xff, 0xff, 0xff, 0x20, 0xff, 0x24, 0xff, 0xff,
+  0x24, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x22, 0xff, 0x22, 0xff, 0x22, 0xff, 0x22,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0x20, 0xff, 0x22, 0xff, 0xff, 0x22, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x22,
+  0xff, 0x22, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x21, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff, 0xff, 0xff, 0xff, 0x20, 0xff, 0xff,
+  0x20, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f,
+  0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
+  0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f,
+  0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0x0f, 0x0f, 0x0f, 0xff,
+  0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff,
+  0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0x0f, 0xff,
+  0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0x0f,
+  0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff
+};
+
+#endif
@@ -0,0 +1,169 @@
+/*
+  MD_TTT_lib.h - Arduino library for TicTacToe game decision engine
+  Copyright (C) 2013 Marco Colli
+  All rights reserved.
+
+  Library internal definitions shared by the library source files.
+  These are not part of the public interface.
+
+  See MD_TTT.h for complete comments
+
+  This library is free software; you can redistribute it and/or
+  modify it under the terms of the GNU Lesser General Public
+  License as published by the Free Software Foundation; either
+  version 2.1 of the License, or (at your option) any later version.
+
+  This library is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+  Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public
+  License along with this library; if not, write to the Free Software
+  Foundation, Inc., 51 Franklin St, Fifth Floor, Boston, MA  02110-1301  USA
+*/
+#ifndef _MD_TTT_LIB_H
+#define _MD_TTT_LIB_H
+
+#define  DEBUG_TTT  0
+
+#if  DEBUG_TTT
+#ifdef ARDUINO
+#define  DEBUG(s, v)  { Serial.print(F(s)); Serial.print(v); }
+#define  DEBUGS(s)    Serial.print(F(s))
+#else
+#define  DEBUG(s, v)  { halPrint(s); halPrint(v); }
+#define  DEBUGS(s)    halPrint(s)
+#endif
+#else
+#define  DEBUG(s, v)
+#define  DEBUGS(s)
+#endif
+
+#if  TTT_USE_STATS
+#define  STATS(s)     s
+// STATS_TIME() takes a time stamp and STATS_NS(t0) is the ns since then.
+// The interval is worked out in the units of the clock, so the clock 
+// wrapping (micros() every 71 minutes) does not matter.
+#ifdef ARDUINO
+typedef uint32_t statsTime_t;
+#define  STATS_TIME()   micros()   ///< to the resolution of micros()
+#define  STATS_NS(t0)   ((uint64_t)(uint32_t)(micros() - (t0)) * 1000)
+#else
+typedef uint64_t statsTime_t;
+#define  STATS_TIME()   halNanos()
+#define  STATS_NS(t0)   (halNanos() - (t0))
+#endif
+#else
+#define  STATS(s)
+#endif
+
+// Bitboard definitions. Bit i of a bitboard is board cell i.
+#define CELL_MASK(i)    ((uint16_t)1 << (i))
+#define TTT_BOARD_MASK  0x1ff   ///< all the cells on the board
+
+// Move stack entry - the cell, the player and whether the move won the game
+#define MOVE_CELL   0x0f  ///< cell number [0..8]
+#define MOVE_P2     0x40  ///< the move was by TTT_P2, otherwise TTT_P1
+#define MOVE_WIN    0x80  ///< the move won the game
+
+// Time-sliced auto player move states
+#define STEP_IDLE     0   ///< no move being worked out
+#define STEP_RUNNING  1   ///< search in progress
+#define STEP_READY    2   ///< move worked out
+
+// Event queue index access. The game and the user code may run in 
+// different threads, so the queue memory must be ordered with the indices.
+#ifdef __GNUC__
+#define EVT_LOAD(x)     __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define EVT_STORE(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#else
+#define EVT_LOAD(x)     (x)
+#define EVT_STORE(x, v) ((x) = (v))
+#endif
+
+// Board geometry. The game tables are generated from these functions by 
+// the compiler, so they cannot disagree with each other. The functions 
+// are only for constant expressions, the code uses the tables.
+constexpr uint8_t tttLineStart(uint8_t l)
+// the first cell of line l (TTT_WL_*)
+{
+  return(l == TTT_WL_D1 ? 0 : l == TTT_WL_D2 ? 2 : l <= TTT_WL_H3 ? 3 * (l - TTT_WL_H1) : l - TTT_WL_V1);
+}
+
+constexpr uint8_t tttLineStep(uint8_t l)
+// the distance between the cells of line l
+{
+  return(l == TTT_WL_D1 ? 4 : l == TTT_WL_D2 ? 2 : l <= TTT_WL_H3 ? 1 : 3);
+}
+
+constexpr uint16_t tttLineMask(uint8_t l)
+// the cells in line l as a bitboard
+{
+  return(CELL_MASK(tttLineStart(l)) | CELL_MASK(tttLineStart(l) + tttLineStep(l)) | CELL_MASK(tttLineStart(l) + 2 * tttLineStep(l)));
+}
+
+constexpr uint8_t tttCellLines(uint8_t k, uint8_t l = 0)
+// the lines through cell k, bit 7 for line 0 (D1) to bit 0 for line 7 (D2)
+{
+  return(l == TTT_WIN_LINES ? 0 : (((tttLineMask(l) >> k) & 1) ? (0x80 >> l) : 0) | tttCellLines(k, l + 1));
+}
+
+constexpr uint8_t tttSymCell(uint8_t s, uint8_t r, uint8_t c)
+// the cell that row r, column c maps onto for symmetry s, in the order 
+// identity, rotate 90, 180 and 270 clockwise, reflect left-right, 
+// top-bottom, on D1 and on D2
+{
+  return(s == 0 ? 3 * r + c       : s == 1 ? 3 * c + (2 - r) :
+         s == 2 ? 3 * (2 - r) + (2 - c) : s == 3 ? 3 * (2 - c) + r :
+         s == 4 ? 3 * r + (2 - c) : s == 5 ? 3 * (2 - r) + c :
+         s == 6 ? 3 * c + r       : 3 * (2 - c) + (2 - r));
+}
+
+// Initializers for tables with an entry for each cell
+#define TTT_CELL_TABLE(f)   { f(0), f(1), f(2), f(3), f(4), f(5), f(6), f(7), f(8) }
+#define TTT_LINE_TABLE(f)   { f(0), f(1), f(2), f(3), f(4), f(5), f(6), f(7) }
+
+// Game tables defined in MD_TTT.cpp
+extern const uint8_t  TTT_wwm[TTT_BOARD_SIZE] PROGMEM;  ///< win weight matrix, MSB is D1
+extern const uint16_t TTT_wlm[TTT_WIN_LINES] PROGMEM;   ///< cells in each win line as a bitboard
+extern const uint8_t  TTT_sym[TTT_SYMMETRIES][TTT_BOARD_SIZE] PROGMEM;  ///< cell map for each board symmetry
+extern const uint32_t TTT_zobrist[2][TTT_BOARD_SIZE] PROGMEM;  ///< Zobrist keys for TTT_P1 and TTT_P2
+
+inline uint8_t countBits(uint16_t b)
+// count the bits set in the bitboard
+{
+  uint8_t n = 0;
+
+  for (; b != 0; n++)
+    b &= b - 1;
+
+  return(n);
+}
+
+inline uint8_t countLines(uint8_t b)
+// count the bits set in a set of lines, without the branches of 
+// countBits() as the number of lines set is not predictable
+{
+  b = b - ((b >> 1) & 0x55);
+  b = (b & 0x33) + ((b >> 2) & 0x33);
+
+  return((b + (b >> 4)) & 0x0f);
+}
+
+inline uint8_t lowestBit(uint16_t b)
+// the number of the lowest bit set in a non-zero bitboard
+{
+#ifdef __GNUC__
+  return(__builtin_ctz(b));
+#else
+  uint8_t n = 0;
+
+  for (; !(b & 1); n++)
+    b >>= 1;
+
+  return(n);
+#endif
+}
+
+#endif
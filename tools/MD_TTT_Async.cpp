@@ -0,0 +1,202 @@
+// Time-sliced auto player moves for the MD_TTT library on a host computer
+//
+// Shows the three ways a host program can use beginAutoMove() and
+// stepAutoMove() to keep working while the search engine finds a move
+// - a cooperative loop, as in an Arduino loop(), reporting the longest
+//   time the loop is held up by one slice against a blocking doMove().
+// - a std::future, with the slices run on another thread.
+// - a C++20 coroutine that yields to a simple scheduler between slices,
+//   if the compiler supports coroutines.
+// This is a host (PC) program, not an Arduino sketch. The library must
+// be built with TTT_USE_STEP set to 1. From the library folder
+//
+//   g++ -O2 -std=c++20 -pthread -DTTT_USE_STEP=1 -Isrc -o Async tools/MD_TTT_Async.cpp src/*.cpp
+//   ./Async [-b budget]
+//
+//   -b  time budget for each slice in microseconds (default 100)
+//
+// With an older compiler use -std=c++11 and the coroutine is left out.
+//
+#include <MD_TTT.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <future>
+#include <thread>
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+#include <coroutine>
+#include <deque>
+#define HAVE_COROUTINE 1
+#else
+#define HAVE_COROUTINE 0
+#endif
+
+#if !TTT_USE_STEP
+#error "Build the library and this program with -DTTT_USE_STEP=1"
+#endif
+
+static double now(void)
+// seconds from an arbitrary start
+{
+  return(std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static void cooperative(uint32_t budget)
+// The first move on an empty board is the longest search. Compare the
+// time doMove() blocks with the longest slice in a cooperative loop.
+{
+  MD_TTT T(NULL);
+  double t, longest = 0, blocking;
+  uint32_t slices = 0;
+
+  T.setAutoPlayer(TTT_P1, TTT_ENGINE_SEARCH);
+  T.start();
+  t = now();
+  T.doMove(0, TTT_P1, true);
+  blocking = now() - t;
+  printf("doMove() blocks for %.0f us, %u nodes\n", blocking * 1e6, T.getSearchNodes());
+
+  T.start();
+  T.beginAutoMove();
+  while (!T.isMoveReady())
+  {
+    t = now();
+    T.stepAutoMove(budget);
+    t = now() - t;
+    if (t > longest) longest = t;
+    slices++;
+
+    // the rest of loop() goes here, eg refresh the display
+  }
+  printf("cooperative loop, %u slices of %u us budget, longest %.0f us, move %c\n",
+    slices, budget, longest * 1e6, 'a' + T.getAutoMove());
+  T.doMove(0, TTT_P1, true);
+}
+
+static void future(uint32_t budget)
+// Work out the move on another thread. The MD_TTT object must not be
+// used by this thread until the future is ready.
+{
+  MD_TTT T(NULL);
+  uint32_t waits = 0;
+
+  T.setAutoPlayer(TTT_P1, TTT_ENGINE_SEARCH);
+  T.start();
+  T.beginAutoMove();
+
+  std::future<uint8_t> move = std::async(std::launch::async, [&T, budget]()
+  {
+    while (!T.stepAutoMove(budget))
+      std::this_thread::yield();
+    return(T.getAutoMove());
+  });
+
+  while (move.wait_for(std::chrono::microseconds(budget)) != std::future_status::ready)
+    waits++;    // this thread is free to do other work
+
+  printf("std::future, move %c after %u waits\n", 'a' + move.get(), waits);
+}
+
+#if HAVE_COROUTINE
+// A minimal coroutine task and round robin scheduler. co_await Yield()
+// puts the coroutine at the back of the queue.
+struct Task
+{
+  struct promise_type
+  {
+    Task get_return_object() { return(Task{ std::coroutine_handle<promise_type>::from_promise(*this) }); }
+    std::suspend_always initial_suspend() noexcept { return(std::suspend_always()); }
+    std::suspend_always final_suspend() noexcept { return(std::suspend_always()); }
+    void return_void() {}
+    void unhandled_exception() { abort(); }
+  };
+
+  std::coroutine_handle<promise_type> h;
+};
+
+static std::deque<std::coroutine_handle<> > ready;
+
+struct Yield
+{
+  bool await_ready() { return(false); }
+  void await_suspend(std::coroutine_handle<> h) { ready.push_back(h); }
+  void await_resume() {}
+};
+
+static Task playGame(uint32_t budget, bool &done)
+// a game between two search engines, yielding between slices
+{
+  MD_TTT T(NULL);
+  int8_t p = TTT_P1;
+
+  T.start();
+  while (!T.isGameOver())
+  {
+    T.setAutoPlayer(p, TTT_ENGINE_SEARCH);
+    T.beginAutoMove();
+    while (!T.stepAutoMove(budget))
+      co_await Yield();
+    T.doMove(0, p, true);
+    p = -p;
+  }
+  printf("coroutine, game over, winner %d\n", T.getGameWinner());
+  done = true;
+}
+
+static Task refresh(uint32_t &ticks, bool &done)
+// stands in for the display refresh and input debouncing
+{
+  while (!done)
+  {
+    ticks++;
+    co_await Yield();
+  }
+}
+
+static void coroutine(uint32_t budget)
+{
+  bool done = false;
+  uint32_t ticks = 0;
+  Task game = playGame(budget, done);
+  Task other = refresh(ticks, done);
+
+  ready.push_back(game.h);
+  ready.push_back(other.h);
+  while (!ready.empty())
+  {
+    std::coroutine_handle<> h = ready.front();
+
+    ready.pop_front();
+    h.resume();
+  }
+  printf("coroutine, the refresh task ran %u times during the game\n", ticks);
+  game.h.destroy();
+  other.h.destroy();
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+  uint32_t budget = 100;
+
+  for (int i=1; i<argc; i++)
+  {
+    if (strcmp(argv[i], "-b") == 0 && i+1 < argc) budget = strtoul(argv[++i], NULL, 10);
+    else
+    {
+      fprintf(stderr, "usage: %s [-b budget]\n", argv[0]);
+      return(1);
+    }
+  }
+
+  cooperative(budget);
+  future(budget);
+#if HAVE_COROUTINE
+  coroutine(budget);
+#else
+  printf("coroutine, not supported by this compiler\n");
+#endif
+
+  return(0);
+}
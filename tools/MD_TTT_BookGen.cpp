@@ -0,0 +1,229 @@
+// Opening book and endgame table generator for the MD_TTT library
+//
+// Solves every TicTacToe board by negamax search and writes the book
+// consulted by the heuristic auto player engine when TTT_USE_BOOK is
+// set. This is a host (PC) program, not an Arduino sketch. To regenerate
+// the book, from the library folder
+//
+//   g++ -O2 -o BookGen tools/MD_TTT_BookGen.cpp
+//   ./BookGen > src/MD_TTT_Book.cpp
+//
+// The book holds the boards with at most BOOK_STONES cells occupied (the
+// opening) or at most ENDGAME_EMPTY cells empty (the endgame), where the
+// player to move has made the same number of moves as the opponent or
+// one less and the game is not over. Only the canonical board, the one
+// of its 8 rotations and reflections with the smallest key, is stored.
+//
+// The key is the base-3 key of the board as seen by the player about to
+// move, as for the perfect play table. Cell i contributes 3^i times 0
+// (empty), 1 (the player to move) or 2 (the opponent). The book is two
+// arrays sorted by key
+// - TTT_bookKey, the canonical key for each board.
+// - TTT_bookMoves, a bitboard of the equally best moves on the canonical
+//   board. The best moves win the soonest (or lose the latest) with
+//   perfect play and, of those, leave the opponent the most replies that
+//   lose, so the opening moves set the most traps for a weaker player.
+//
+#include <stdio.h>
+#include <stdint.h>
+#include <algorithm>
+#include <vector>
+
+#define BOARD_SIZE    9
+#define TABLE_SIZE    19683 // 3^9
+#define BOOK_STONES   2     // opening, the auto player's first 2 moves
+#define ENDGAME_EMPTY 4     // endgame, 4 empty cells or less
+
+// The cells in each winning line as a bitboard mask
+static const uint16_t wlm[] =
+{
+  0b100010001, 0b000000111, 0b000111000, 0b111000000,
+  0b001001001, 0b010010010, 0b100100100, 0b001010100
+};
+
+// Board symmetries, the cell that each cell maps onto (as in MD_TTT.cpp)
+static const uint8_t sym[8][BOARD_SIZE] =
+{
+  { 0, 1, 2, 3, 4, 5, 6, 7, 8 },
+  { 2, 5, 8, 1, 4, 7, 0, 3, 6 },
+  { 8, 7, 6, 5, 4, 3, 2, 1, 0 },
+  { 6, 3, 0, 7, 4, 1, 8, 5, 2 },
+  { 2, 1, 0, 5, 4, 3, 8, 7, 6 },
+  { 6, 7, 8, 3, 4, 5, 0, 1, 2 },
+  { 0, 3, 6, 1, 4, 7, 2, 5, 8 },
+  { 8, 5, 2, 7, 4, 1, 6, 3, 0 }
+};
+
+static bool   solved[TABLE_SIZE];
+static int8_t score[TABLE_SIZE];
+
+bool isWin(uint16_t b)
+// true if the bitboard has a complete line
+{
+  for (uint8_t i=0; i<sizeof(wlm)/sizeof(wlm[0]); i++)
+    if ((b & wlm[i]) == wlm[i])
+      return(true);
+
+  return(false);
+}
+
+uint16_t boardKey(uint16_t own, uint16_t opp)
+// base-3 key for the board from the point of view of the player to move
+{
+  uint16_t key = 0;
+
+  for (int8_t i=BOARD_SIZE-1; i>=0; i--)
+  {
+    key *= 3;
+    if (own & (1 << i)) key += 1;
+    else if (opp & (1 << i)) key += 2;
+  }
+
+  return(key);
+}
+
+uint16_t symBoard(uint16_t b, uint8_t s)
+// the bitboard b transformed by symmetry s
+{
+  uint16_t t = 0;
+
+  for (uint8_t i=0; i<BOARD_SIZE; i++)
+    if (b & (1 << i)) t |= (1 << sym[s][i]);
+
+  return(t);
+}
+
+int8_t solve(uint16_t own, uint16_t opp)
+// Negamax score for the player to move. A win is scored higher the
+// sooner it happens (and a loss the later), as for the perfect play table.
+{
+  uint16_t key = boardKey(own, opp);
+  uint16_t empty = ~(own | opp) & 0x1ff;
+  int8_t   best = -100;
+
+  if (solved[key])
+    return(score[key]);
+
+  if (isWin(opp))
+    best = -(1 + __builtin_popcount(empty));  // the opponent has just won
+  else if (empty == 0)
+    best = 0;                                 // draw
+  else
+  {
+    for (uint8_t i=0; i<BOARD_SIZE; i++)
+      if (empty & (1 << i))
+        best = std::max(best, (int8_t)-solve(opp, own | (1 << i)));
+  }
+
+  solved[key] = true;
+  score[key] = best;
+
+  return(best);
+}
+
+uint8_t traps(uint16_t own, uint16_t opp)
+// the number of opponent replies that lose after own has moved
+{
+  uint16_t empty = ~(own | opp) & 0x1ff;
+  uint8_t n = 0;
+
+  if (isWin(own))
+    return(0);
+
+  for (uint8_t i=0; i<BOARD_SIZE; i++)
+    if ((empty & (1 << i)) && solve(own, opp | (1 << i)) > 0)
+      n++;
+
+  return(n);
+}
+
+uint16_t bestMoves(uint16_t own, uint16_t opp)
+// bitboard of the equally best moves for the player to move
+{
+  uint16_t empty = ~(own | opp) & 0x1ff;
+  uint16_t moves = 0;
+  int8_t   best = -100;
+  uint8_t  bestTraps = 0;
+
+  for (uint8_t i=0; i<BOARD_SIZE; i++)
+  {
+    if (!(empty & (1 << i)))
+      continue;
+
+    int8_t s = -solve(opp, own | (1 << i));
+    uint8_t t = traps(own | (1 << i), opp);
+
+    if (s > best || (s == best && t > bestTraps))
+    {
+      best = s;
+      bestTraps = t;
+      moves = 0;
+    }
+    if (s == best && t == bestTraps)
+      moves |= (1 << i);
+  }
+
+  return(moves);
+}
+
+int main(void)
+{
+  std::vector<uint16_t> keys;
+  uint16_t opening = 0;
+
+  for (uint32_t b=0; b<(1UL << (2 * BOARD_SIZE)); b++)
+  {
+    uint16_t own = b & 0x1ff, opp = b >> BOARD_SIZE;
+    uint8_t nOwn = __builtin_popcount(own), nOpp = __builtin_popcount(opp);
+    uint16_t key = 0xffff;
+
+    if ((own & opp) || (nOwn != nOpp && nOwn + 1 != nOpp))
+      continue;   // not a board where this player can be about to move
+    if (nOwn + nOpp > BOOK_STONES && nOwn + nOpp < BOARD_SIZE - ENDGAME_EMPTY)
+      continue;   // not in the book
+    if (nOwn + nOpp == BOARD_SIZE || isWin(own) || isWin(opp))
+      continue;   // game over
+
+    for (uint8_t s=0; s<8; s++)
+      key = std::min(key, boardKey(symBoard(own, s), symBoard(opp, s)));
+    if (key == boardKey(own, opp))
+    {
+      keys.push_back(key);
+      if (nOwn + nOpp <= BOOK_STONES) opening++;
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+
+  printf("// MD_TTT opening book and endgame table - %u opening and %u endgame boards\n", opening, (unsigned)keys.size() - opening);
+  printf("//\n");
+  printf("// Generated by tools/MD_TTT_BookGen.cpp - DO NOT EDIT.\n");
+  printf("// See the generator for a description of the book format.\n");
+  printf("//\n");
+  printf("#include <MD_TTT.h>\n\n");
+  printf("#if TTT_USE_BOOK\n\n");
+  printf("extern const uint16_t TTT_bookSize = %u;\n\n", (unsigned)keys.size());
+  printf("extern const uint16_t TTT_bookKey[%u] PROGMEM =\n{", (unsigned)keys.size());
+  for (size_t i=0; i<keys.size(); i++)
+  {
+    if (i % 12 == 0) printf("\n ");
+    printf(" %5u%s", keys[i], (i == keys.size()-1) ? "" : ",");
+  }
+  printf("\n};\n\n");
+  printf("extern const uint16_t TTT_bookMoves[%u] PROGMEM =\n{", (unsigned)keys.size());
+  for (size_t i=0; i<keys.size(); i++)
+  {
+    uint16_t own = 0, opp = 0;
+
+    for (uint16_t k=keys[i], c=0; c<BOARD_SIZE; k/=3, c++)
+    {
+      if (k % 3 == 1) own |= (1 << c);
+      else if (k % 3 == 2) opp |= (1 << c);
+    }
+    if (i % 12 == 0) printf("\n ");
+    printf(" 0x%03x%s", bestMoves(own, opp), (i == keys.size()-1) ? "" : ",");
+  }
+  printf("\n};\n\n");
+  printf("#endif\n");
+
+  return(0);
+}
@@ -0,0 +1,505 @@
+// Position space enumerator for the MD_TTT library
+//
+// Plays out the complete TicTacToe game tree with the MD_TTT move logic
+// (doMove() and undoMove()) and collects every board that can be reached
+// in a game, with and without the rotations and reflections of the board
+// counted as the same board (using getBoardHash()). For each board it
+// works out the game value with perfect play and the best moves, and then
+// plays the heuristic auto player against a perfect opponent from every
+// board where the game is not over, to find where the heuristic does worse
+// than the game value. The work is shared out between a number of threads,
+// each with its own MD_TTT object.
+// This is a host (PC) program for Linux, not an Arduino sketch. From the
+// library folder
+//
+//   g++ -O2 -pthread -DTTT_USE_UNDO=1 -Isrc -Itools -o Enum tools/MD_TTT_Enum.cpp src/*.cpp
+//   ./Enum [-o file] [-t threads] [-r trials] [-s seed]
+//   ./Enum -v file
+//
+//   -o  the position space file to write (default positions.bin)
+//   -t  number of threads (default all the processor cores)
+//   -r  heuristic games from each board, at most 255 (default 16)
+//   -s  seed for the random choices (default 1)
+//   -v  map an existing file into memory and print its counts
+//
+// The file layout is in tools/MD_TTT_Positions.h. The program prints
+// the counts, and exits with a non-zero status if the game tree counts
+// are not the known ones (5478 boards, 765 without symmetry, 255168 games).
+// The heuristic games from a board start from a seed worked out from the
+// board key, so the results are the same whatever the number of threads.
+//
+#include <MD_TTT.h>
+#include <MD_TTT_Positions.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if !TTT_USE_UNDO
+#error "Build the library and this program with -DTTT_USE_UNDO=1"
+#endif
+
+#define KEYS  19683   // 3^9 board keys
+
+static const uint16_t pow3[TTT_BOARD_SIZE] = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561 };
+
+// Access to the protected auto player move selection
+class EnumTTT : public MD_TTT
+{
+public:
+  EnumTTT(void) : MD_TTT(NULL) {}
+  uint8_t autoMove(int8_t player) { return(doAutoMove(player)); }
+};
+
+// The game tree counts for a part of the tree, one for each thread.
+struct Tree
+{
+  std::vector<uint32_t> paths;  // indexed by board key
+  std::vector<uint32_t> games;
+  std::vector<uint32_t> hash;
+  std::vector<uint16_t> best;
+  std::vector<uint8_t>  status;
+  std::vector<int8_t>   value;
+  uint32_t nodes;
+  uint32_t gameWins[3];
+  uint32_t gameLength[TTT_BOARD_SIZE+1];
+
+  Tree(void) : paths(KEYS), games(KEYS), hash(KEYS), best(KEYS), status(KEYS), value(KEYS), nodes(0)
+  {
+    memset(gameWins, 0, sizeof(gameWins));
+    memset(gameLength, 0, sizeof(gameLength));
+  }
+};
+
+static double now(void)
+// seconds from an arbitrary start
+{
+  return(std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static uint32_t xorshift(uint32_t &x)
+{
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+
+  return(x);
+}
+
+static uint16_t keyAfter(uint16_t key, uint8_t cell, int8_t player)
+// the board key after player moves into the cell
+{
+  return(key + pow3[cell] * (player == TTT_P1 ? 1 : 2));
+}
+
+static uint32_t walk(EnumTTT &T, uint16_t key, int8_t player, uint8_t moves, Tree &t, int8_t *pValue)
+// Visit the board and every board below it in the game tree. Returns the
+// number of complete games from here and the game value for player.
+{
+  t.nodes++;
+  t.paths[key]++;
+  t.hash[key] = T.getBoardHash();
+
+  if (T.isGameOver())
+  {
+    int8_t w = T.getGameWinner();
+
+    t.status[key] = (w == TTT_P1 ? TTT_POS_WIN_P1 : (w == TTT_P2 ? TTT_POS_WIN_P2 : TTT_POS_DRAW));
+    t.gameWins[w + 1]++;
+    t.gameLength[moves]++;
+    t.games[key]++;
+    *pValue = (w == TTT_P0 ? TTT_VAL_DRAW : TTT_VAL_LOSS);  // only the last player to move can have won
+    return(1);
+  }
+
+  int8_t   v = TTT_VAL_LOSS - 1;
+  uint16_t best = 0;
+  uint32_t games = 0;
+
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+  {
+    int8_t cv;
+
+    if (T.getBoardPosition(i) != TTT_P0)
+      continue;
+
+    T.doMove(i, player, true);
+    games += walk(T, keyAfter(key, i, player), -player, moves + 1, t, &cv);
+    T.undoMove(true);
+
+    cv = -cv;
+    if (cv > v) { v = cv; best = 0; }
+    if (cv == v) best |= (1 << i);
+  }
+
+  t.status[key] = (player == TTT_P1 ? TTT_POS_TO_P1 : TTT_POS_TO_P2);
+  t.games[key] += games;
+  t.value[key] = v;
+  t.best[key] = best;
+  *pValue = v;
+
+  return(games);
+}
+
+static uint32_t walkTop(EnumTTT &T, uint16_t key, int8_t player, uint8_t moves, Tree &t, int8_t *pValue)
+// Visit the boards above the ones walked by the threads, using their
+// results. No game can be over in the first two moves.
+{
+  if (moves == 2)
+  {
+    *pValue = t.value[key];
+    return(t.games[key]);
+  }
+
+  int8_t   v = TTT_VAL_LOSS - 1;
+  uint16_t best = 0;
+  uint32_t games = 0;
+
+  t.nodes++;
+  t.paths[key]++;
+  t.hash[key] = T.getBoardHash();
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+  {
+    int8_t cv;
+
+    if (T.getBoardPosition(i) != TTT_P0)
+      continue;
+
+    T.doMove(i, player, true);
+    games += walkTop(T, keyAfter(key, i, player), -player, moves + 1, t, &cv);
+    T.undoMove(true);
+
+    cv = -cv;
+    if (cv > v) { v = cv; best = 0; }
+    if (cv == v) best |= (1 << i);
+  }
+
+  t.status[key] = (player == TTT_P1 ? TTT_POS_TO_P1 : TTT_POS_TO_P2);
+  t.games[key] = games;
+  t.value[key] = v;
+  t.best[key] = best;
+  *pValue = v;
+
+  return(games);
+}
+
+static void merge(Tree &all, const Tree &t)
+// Add the counts for a part of the tree to the whole tree
+{
+  for (uint32_t k=0; k<KEYS; k++)
+  {
+    if (t.paths[k] == 0)
+      continue;
+
+    all.paths[k] += t.paths[k];
+    all.games[k] += t.games[k];
+    all.hash[k] = t.hash[k];
+    all.best[k] = t.best[k];
+    all.status[k] = t.status[k];
+    all.value[k] = t.value[k];
+  }
+  all.nodes += t.nodes;
+  for (uint8_t i=0; i<3; i++)
+    all.gameWins[i] += t.gameWins[i];
+  for (uint8_t i=0; i<=TTT_BOARD_SIZE; i++)
+    all.gameLength[i] += t.gameLength[i];
+}
+
+static void enumerate(Tree &all, uint32_t threads)
+// Walk the game tree below each of the 72 boards after two moves, each
+// thread taking the next board until there are none left.
+{
+  std::atomic<uint32_t> next(0);
+  std::vector<Tree> local(threads);
+  std::vector<std::thread> pool;
+
+  for (uint32_t n=0; n<threads; n++)
+  {
+    pool.push_back(std::thread([&, n]()
+    {
+      EnumTTT T;
+      uint32_t i;
+
+      while ((i = next++) < TTT_BOARD_SIZE * TTT_BOARD_SIZE)
+      {
+        uint8_t m1 = i / TTT_BOARD_SIZE, m2 = i % TTT_BOARD_SIZE;
+        int8_t v;
+
+        if (m1 == m2)
+          continue;
+
+        T.start();
+        T.doMove(m1, TTT_P1, true);
+        T.doMove(m2, TTT_P2, true);
+        walk(T, keyAfter(keyAfter(0, m1, TTT_P1), m2, TTT_P2), TTT_P1, 2, local[n], &v);
+      }
+    }));
+  }
+  for (uint32_t n=0; n<threads; n++)
+    pool[n].join();
+
+  for (uint32_t n=0; n<threads; n++)
+    merge(all, local[n]);
+
+  EnumTTT T;
+  int8_t v;
+
+  T.start();
+  walkTop(T, 0, TTT_P1, 0, all, &v);
+}
+
+static bool playHeuristic(EnumTTT &T, const Tree &all, uint16_t key, uint32_t trials, uint32_t seed, tttPosRecord &r)
+// Play the heuristic auto player for the player to move from the board
+// against a perfect opponent, choosing at random between its best moves.
+// Returns true if the heuristic did worse than the game value.
+{
+  int8_t  me = (all.status[key] & TTT_POS_TO_P1) ? TTT_P1 : TTT_P2;
+  uint8_t cells[2][TTT_BOARD_SIZE], count[2] = { 0, 0 };
+  uint8_t worst = 2;
+
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+  {
+    uint8_t c = (key / pow3[i]) % 3;
+
+    if (c != 0)
+      cells[c-1][count[c-1]++] = i;
+  }
+
+  for (uint32_t n=0; n<trials; n++)
+  {
+    uint32_t rnd = (seed * 0x9e3779b9UL) ^ (key * trials + n + 1);
+    uint16_t k = key;
+    int8_t p = me;
+
+    // Set up the board, alternating the players' cells. The game is not
+    // over on the board, so it is not over part way through.
+    T.start();
+    T.setSeed(rnd);
+    for (uint8_t i=0; i<count[0]; i++)
+    {
+      T.doMove(cells[0][i], TTT_P1, true);
+      if (i < count[1])
+        T.doMove(cells[1][i], TTT_P2, true);
+    }
+
+    while (!T.isGameOver())
+    {
+      uint8_t cell;
+
+      if (p == me)
+        cell = T.autoMove(p);
+      else
+      {
+        uint16_t best = all.best[k];
+        uint8_t choice = xorshift(rnd) % __builtin_popcount(best);
+
+        for (cell=0; !(best & (1 << cell)) || choice-- != 0; cell++)
+          ;
+      }
+
+      T.doMove(cell, p, true);
+      k = keyAfter(k, cell, p);
+      p = -p;
+    }
+
+    uint8_t result = (T.getGameWinner() == TTT_P0 ? 1 : (T.getGameWinner() == me ? 2 : 0));
+
+    r.heur[result]++;
+    if (result < worst)
+      worst = result;
+  }
+
+  return((int8_t)worst - 1 < all.value[key]);
+}
+
+static uint32_t heuristic(const Tree &all, std::vector<tttPosRecord> &rec, uint32_t trials, uint32_t seed, uint32_t threads)
+// Play the heuristic games from each board where the game is not over,
+// each thread taking the next block of boards until there are none left.
+// Returns the number of boards where the heuristic did worse than the
+// game value.
+{
+  std::atomic<uint32_t> next(0), worse(0);
+  std::vector<std::thread> pool;
+  const uint32_t block = 64;
+
+  for (uint32_t n=0; n<threads; n++)
+  {
+    pool.push_back(std::thread([&]()
+    {
+      EnumTTT T;
+      uint32_t i;
+
+      while ((i = next.fetch_add(block)) < rec.size())
+        for (uint32_t j=i; j<i+block && j<rec.size(); j++)
+          if ((rec[j].status & (TTT_POS_TO_P1 | TTT_POS_TO_P2)) &&
+            playHeuristic(T, all, rec[j].key, trials, seed, rec[j]))
+            worse++;
+    }));
+  }
+  for (uint32_t n=0; n<threads; n++)
+    pool[n].join();
+
+  return(worse);
+}
+
+static void printCounts(const tttPosHeader &h)
+{
+  printf("Boards         %8u, %u without symmetry\n", h.positions, h.canonical);
+  printf("Game over      %8u, %u without symmetry\n", h.terminal, h.terminalCanon);
+  printf("Tree nodes     %8u\n", h.nodes);
+  printf("Games          %8u: TTT_P1 wins %u, TTT_P2 wins %u, draws %u\n", h.games, h.gameWins[2], h.gameWins[0], h.gameWins[1]);
+  printf("Game length   ");
+  for (uint8_t i=0; i<=TTT_BOARD_SIZE; i++)
+    if (h.gameLength[i] != 0)
+      printf(" %u:%u", i, h.gameLength[i]);
+  printf("\n");
+  if (h.trials != 0)
+  {
+    uint32_t all = h.heurTrials[0] + h.heurTrials[1] + h.heurTrials[2];
+
+    printf("Heuristic      %8u games against a perfect opponent, %u from each board\n", all, h.trials);
+    printf("               lost %.2f%%, drawn %.2f%%, won %.2f%%\n",
+      100.0 * h.heurTrials[0] / all, 100.0 * h.heurTrials[1] / all, 100.0 * h.heurTrials[2] / all);
+    printf("               worse than the game value from %u boards\n", h.heurWorse);
+  }
+}
+
+static int view(const char *name)
+// Map the file into memory and print the counts in it
+{
+  int fd = open(name, O_RDONLY);
+  struct stat st;
+
+  if (fd < 0 || fstat(fd, &st) != 0)
+  {
+    perror(name);
+    return(1);
+  }
+
+  void *file = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  close(fd);
+  if (file == MAP_FAILED || !tttPosValid(file, st.st_size))
+  {
+    fprintf(stderr, "%s: not a position space file\n", name);
+    return(1);
+  }
+
+  const tttPosRecord *r = tttPosFind(file, 0);
+
+  printCounts(*(const tttPosHeader *)file);
+  if (r != NULL)
+    printf("Empty board    game value %d, best moves 0x%03x\n", r->value, r->best);
+  munmap(file, st.st_size);
+
+  return(0);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *name = "positions.bin";
+  uint32_t threads = std::thread::hardware_concurrency();
+  uint32_t trials = 16;
+  uint32_t seed = 1;
+
+  for (int i=1; i<argc; i++)
+  {
+    if (strcmp(argv[i], "-o") == 0 && i+1 < argc) name = argv[++i];
+    else if (strcmp(argv[i], "-t") == 0 && i+1 < argc) threads = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-r") == 0 && i+1 < argc) trials = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-s") == 0 && i+1 < argc) seed = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-v") == 0 && i+1 < argc) return(view(argv[++i]));
+    else
+    {
+      fprintf(stderr, "usage: %s [-o file] [-t threads] [-r trials] [-s seed] | -v file\n", argv[0]);
+      return(1);
+    }
+  }
+  if (threads == 0) threads = 1;
+  if (trials > 255) trials = 255;
+
+  Tree all;
+  tttPosHeader h;
+  std::vector<tttPosRecord> rec;
+  std::unordered_map<uint32_t, uint16_t> canon;   // the smallest key for each board hash
+  double t0 = now();
+
+  enumerate(all, threads);
+  double t1 = now();
+
+  memset(&h, 0, sizeof(h));
+  memcpy(h.magic, TTT_POS_MAGIC, sizeof(h.magic));
+  h.version = TTT_POS_VERSION;
+  h.recordSize = sizeof(tttPosRecord);
+  h.nodes = all.nodes;
+  memcpy(h.gameWins, all.gameWins, sizeof(h.gameWins));
+  memcpy(h.gameLength, all.gameLength, sizeof(h.gameLength));
+  h.games = h.gameWins[0] + h.gameWins[1] + h.gameWins[2];
+  h.trials = trials;
+
+  for (uint32_t k=0; k<KEYS; k++)
+  {
+    if (all.paths[k] == 0)
+      continue;
+
+    tttPosRecord r;
+    bool over = !(all.status[k] & (TTT_POS_TO_P1 | TTT_POS_TO_P2));
+
+    memset(&r, 0, sizeof(r));
+    r.key = k;
+    r.canon = canon.insert(std::make_pair(all.hash[k], (uint16_t)k)).first->second;
+    r.paths = all.paths[k];
+    r.games = all.games[k];
+    r.status = all.status[k] | (r.canon == k ? TTT_POS_CANON : 0);
+    r.value = over ? 0 : all.value[k];
+    r.best = over ? 0 : all.best[k];
+    for (uint32_t d=k; d!=0; d/=3)
+      r.moves += (d % 3 != 0);
+    rec.push_back(r);
+
+    h.positions++;
+    h.canonical += (r.canon == k);
+    h.terminal += over;
+    h.terminalCanon += (over && r.canon == k);
+  }
+
+  h.heurWorse = heuristic(all, rec, trials, seed, threads);
+  double t2 = now();
+
+  for (uint32_t i=0; i<rec.size(); i++)
+    for (uint8_t j=0; j<3; j++)
+      h.heurTrials[j] += rec[i].heur[j];
+
+  FILE *f = fopen(name, "wb");
+
+  if (f == NULL || fwrite(&h, sizeof(h), 1, f) != 1 ||
+    fwrite(rec.data(), sizeof(tttPosRecord), rec.size(), f) != rec.size() || fclose(f) != 0)
+  {
+    perror(name);
+    return(1);
+  }
+
+  printf("MD_TTT position space, %u threads\n\n", threads);
+  printCounts(h);
+  printf("\nGame tree %.3f s, heuristic games %.3f s\n", t1 - t0, t2 - t1);
+  printf("Wrote %s, %u bytes\n", name, (uint32_t)(sizeof(h) + rec.size() * sizeof(tttPosRecord)));
+
+  // the known counts for the game
+  if (h.positions != 5478 || h.canonical != 765 || h.terminal != 958 || h.terminalCanon != 138 ||
+    h.nodes != 549946 || h.games != 255168 || h.gameWins[2] != 131184 || h.gameWins[0] != 77904 ||
+    all.value[0] != TTT_VAL_DRAW)
+  {
+    printf("\nThe counts are not the known ones!\n");
+    return(1);
+  }
+
+  return(0);
+}
@@ -0,0 +1,228 @@
+// Event queue test for the MD_TTT library on a host computer
+//
+// Checks the event queue (see Event Queue in MD_TTT.h) with the game and
+// the display in different threads, as they may be in a sketch that
+// plays in an interrupt. One thread plays random games, taking moves
+// back now and then, including the move that ended the game. The other
+// takes the events out of a small queue, so some are lost, and keeps its
+// own copy of the board. Each event must make sense for that copy unless
+// events were lost since the last TTT_EVT_CLEAR, and at the end the copy
+// must match the game.
+// This is a host (PC) program, not an Arduino sketch. It is run by ctest
+// in the CMake build, or from the library folder
+//
+//   g++ -O2 -pthread -DTTT_USE_UNDO=1 -DTTT_USE_EVENTS=1 -Isrc -o Events tools/MD_TTT_Events.cpp src/*.cpp
+//   ./Events [-g games] [-q size]
+//
+//   -g  number of games (default 200000)
+//   -q  size of the event queue in bytes (default 16)
+//
+// Build with -fsanitize=thread (or the TTT_SANITIZE CMake option) to
+// check the queue for data races. The program exits with a non-zero
+// status if any event is wrong.
+//
+#include <MD_TTT.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+
+#if !TTT_USE_UNDO || !TTT_USE_EVENTS
+#error "Build the library and this program with -DTTT_USE_UNDO=1 -DTTT_USE_EVENTS=1"
+#endif
+
+static uint32_t xorshift(uint32_t &x)
+{
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+
+  return(x);
+}
+
+static bool hasLine(const int8_t *board, int8_t p, uint8_t line)
+{
+  static const uint8_t cells[TTT_WIN_LINES][3] =
+  { {0,4,8}, {0,1,2}, {3,4,5}, {6,7,8}, {0,3,6}, {1,4,7}, {2,5,8}, {2,4,6} };
+
+  return(board[cells[line][0]] == p && board[cells[line][1]] == p && board[cells[line][2]] == p);
+}
+
+static void produce(MD_TTT &T, uint32_t games)
+// Play the games, with the moves sent to the queue. The game never waits 
+// for the display, but yields now and then so the display keeps up with 
+// most of the games and not all the events are lost.
+{
+  uint32_t rnd = 1;
+
+  for (uint32_t g=0; g<games; g++)
+  {
+    int8_t p = TTT_P1;
+
+    T.start();
+    for (;;)
+    {
+      if (xorshift(rnd) % 8 != 0)
+        std::this_thread::yield();
+
+      if (T.isGameOver())
+      {
+        // sometimes take back the end of the game and play on
+        if (xorshift(rnd) % 2 == 0)
+          break;
+        T.undoMove();
+        p = -p;
+      }
+      else if (T.getMoveCount() > 0 && xorshift(rnd) % 4 == 0)
+      {
+        T.undoMove();
+        p = -p;
+      }
+      else
+      {
+        uint8_t m;
+
+        do
+          m = xorshift(rnd) % TTT_BOARD_SIZE;
+        while (T.getBoardPosition(m) != TTT_P0);
+        T.doMove(m, p);
+        p = -p;
+      }
+    }
+  }
+}
+
+struct Display
+{
+  int8_t   board[TTT_BOARD_SIZE];
+  bool     over;
+  bool     stale;    // events were lost since the last clear
+  uint32_t events, syncs, errors;
+};
+
+static void consume(Display &D, const tttEvent &e)
+// Update the display copy of the board, checking the event against it
+{
+  bool ok = true;
+
+  D.events++;
+  switch (e.type)
+  {
+  case TTT_EVT_CLEAR:
+    memset(D.board, TTT_P0, sizeof(D.board));
+    D.over = D.stale = false;
+    break;
+
+  case TTT_EVT_CELL:
+    if (e.pos >= TTT_BOARD_SIZE)
+      ok = false;
+    else
+    {
+      // a player moves to an empty cell in play, a move taken back empties a cell
+      ok = (e.player == TTT_P0 ? D.board[e.pos] != TTT_P0 : (D.board[e.pos] == TTT_P0 && !D.over));
+      D.board[e.pos] = e.player;
+    }
+    break;
+
+  case TTT_EVT_OVER:
+    if (e.player == TTT_P0)
+    {
+      ok = (e.pos == 0xff);
+      for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+        ok = ok && (D.board[i] != TTT_P0);
+    }
+    else
+      ok = (e.pos < TTT_WIN_LINES && hasLine(D.board, e.player, e.pos));
+    D.over = true;
+    break;
+
+  case TTT_EVT_RESUME:
+    ok = D.over;
+    D.over = false;
+    break;
+
+  case TTT_EVT_SYNC:
+    // the board cannot be read while the other thread plays, so only
+    // note that the copy is out of date
+    D.syncs++;
+    D.stale = true;
+    break;
+
+  default:
+    ok = false;
+    break;
+  }
+
+  if (!ok && !D.stale)
+  {
+    if (D.errors == 0)
+      printf("event %u type %u pos %u player %d is wrong\n", D.events, e.type, e.pos, e.player);
+    D.errors++;
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t games = 200000;
+  uint32_t size = 16;
+  static uint8_t queue[128];
+  std::atomic<bool> done(false);
+  Display D;
+  MD_TTT T(NULL);
+  tttEvent e;
+
+  for (int i=1; i<argc; i++)
+  {
+    if (strcmp(argv[i], "-g") == 0 && i+1 < argc) games = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-q") == 0 && i+1 < argc) size = strtoul(argv[++i], NULL, 10);
+    else
+    {
+      fprintf(stderr, "usage: %s [-g games] [-q size]\n", argv[0]);
+      return(1);
+    }
+  }
+  if (size > sizeof(queue)) size = sizeof(queue);
+
+  memset(&D, 0, sizeof(D));
+  D.stale = true;   // until the first clear
+  if (!T.setEventQueue(queue, size))
+  {
+    fprintf(stderr, "bad queue size %u\n", size);
+    return(1);
+  }
+
+  std::thread game([&]()
+  {
+    produce(T, games);
+    done = true;
+  });
+
+  while (!done)
+  {
+    if (T.getEvent(&e))
+      consume(D, e);
+    else
+      std::this_thread::yield();
+  }
+  game.join();
+  while (T.getEvent(&e))
+    consume(D, e);
+
+  // the game has stopped, so now the board can be read
+  if (D.stale)
+  {
+    for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+      D.board[i] = T.getBoardPosition(i);
+    D.over = T.isGameOver();
+  }
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+    if (D.board[i] != T.getBoardPosition(i))
+      D.errors++;
+  if (D.over != T.isGameOver())
+    D.errors++;
+
+  printf("MD_TTT event test: %u games, %u events, %u syncs, %u wrong\n", games, D.events, D.syncs, D.errors);
+
+  return(D.errors == 0 ? 0 : 1);
+}
@@ -0,0 +1,235 @@
+// Performance benchmark for the MD_TTT library on a host computer
+//
+// Measures the speed of the main library functions, so that changes
+// that make the library slower are found before they reach a sketch.
+// This is a host (PC) program, not an Arduino sketch. From the library
+// folder
+//
+//   g++ -O2 -Isrc -o HostBench tools/MD_TTT_HostBench.cpp src/*.cpp
+//   ./HostBench
+//
+// or build the md_ttt_bench target of the CMake build, or md_ttt_bench_full
+// for the library with all the optional game state (TTT_USE_SCORES etc).
+//
+// Each test is run for about a second and reports the time per
+// operation and the operations per second. The program exits with a
+// non-zero status if the results of any test are not as expected
+// (eg, the perfect play engine loses a game).
+//
+#include <MD_TTT.h>
+#include <stdio.h>
+#include <chrono>
+
+#define RUN_TIME  1.0   // seconds to run each test
+
+// Access to the protected auto player move selection
+class BenchTTT : public MD_TTT
+{
+public:
+  BenchTTT(void) : MD_TTT(NULL) {}
+  uint8_t autoMove(int8_t player) { return(doAutoMove(player)); }
+};
+
+static tttTransEntry transTable[512];
+static uint32_t seed = 1;
+
+static uint8_t randomCell(MD_TTT &T)
+// an empty cell on the board chosen with a xorshift32 generator
+{
+  uint8_t m;
+
+  do
+  {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    m = seed % TTT_BOARD_SIZE;
+  } while (T.getBoardPosition(m) != TTT_P0);
+
+  return(m);
+}
+
+static double now(void)
+// seconds from an arbitrary start
+{
+  return(std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static void report(const char *name, const char *unit, uint32_t count, double time)
+{
+  printf("%-32s %10.1f ns/%s %12.0f %s/s\n", name, time * 1e9 / count, unit, count / time, unit);
+}
+
+static void benchDoMove(void)
+// random games with no auto player, so this is just doMove() and start()
+{
+  BenchTTT T;
+  uint32_t moves = 0;
+  double start = now(), time;
+
+  do
+  {
+    for (uint16_t g=0; g<1000; g++)
+    {
+      int8_t p = TTT_P1;
+
+      T.start();
+      while (!T.isGameOver())
+      {
+        T.doMove(randomCell(T), p);
+        p = -p;
+        moves++;
+      }
+    }
+    time = now() - start;
+  } while (time < RUN_TIME);
+
+  report("doMove() random games", "move", moves, time);
+}
+
+static void benchAutoMove(const char *name, uint8_t engine, bool useTT)
+// the auto player move for every position reached in random games,
+// including the time to make the random move
+{
+  BenchTTT T;
+  uint32_t moves = 0;
+  double start = now(), time;
+
+  T.setAutoPlayer(TTT_P1, engine);
+#if TTT_USE_HASH
+  T.setTransTable(useTT ? transTable : NULL, sizeof(transTable));
+#else
+  (void)useTT;
+#endif
+  T.setSeed(1);
+  do
+  {
+    for (uint16_t g=0; g<100; g++)
+    {
+      int8_t p = TTT_P1;
+
+      T.start();
+      while (!T.isGameOver())
+      {
+        T.autoMove(p);
+        T.doMove(randomCell(T), p, true);
+        p = -p;
+        moves++;
+      }
+    }
+    time = now() - start;
+  } while (time < RUN_TIME);
+
+  report(name, "move", moves, time);
+}
+
+static bool benchGames(const char *name, uint8_t engine1, uint8_t engine2, bool noLoss)
+// complete games between two auto players, returns false if noLoss is
+// set and a game is not drawn
+{
+  BenchTTT T;
+  uint32_t games = 0, lost = 0;
+  double start = now(), time;
+
+#if TTT_USE_HASH
+  T.setTransTable(transTable, sizeof(transTable));
+#endif
+  T.setSeed(1);
+  do
+  {
+    for (uint16_t g=0; g<100; g++)
+    {
+      int8_t p = TTT_P1;
+
+      T.start();
+      while (!T.isGameOver())
+      {
+        T.setAutoPlayer(p, p == TTT_P1 ? engine1 : engine2);
+        T.doMove(0, p, true);
+        p = -p;
+      }
+      if (T.getGameWinner() != TTT_P0)
+        lost++;
+      games++;
+    }
+    time = now() - start;
+  } while (time < RUN_TIME);
+
+  report(name, "game", games, time);
+
+  if (noLoss && lost != 0)
+  {
+    printf("*** %u games were not drawn\n", lost);
+    return(false);
+  }
+
+  return(true);
+}
+
+static void benchBatch(void)
+// evalBoards() for batches of random boards
+{
+  const uint16_t BATCH = 1024;
+  static tttBoard board[BATCH];
+  static uint8_t move[BATCH];
+  static int8_t winner[BATCH];
+  BenchTTT T;
+  uint32_t boards = 0;
+  double start, time;
+
+  for (uint16_t i=0; i<BATCH; i++)
+  {
+    uint8_t n = i % TTT_BOARD_SIZE;
+    int8_t p = TTT_P1;
+
+    T.start();
+    board[i].p1 = board[i].p2 = 0;
+    for (uint8_t j=0; j<n && !T.isGameOver(); j++)
+    {
+      uint8_t m = randomCell(T);
+
+      T.doMove(m, p, true);
+      if (p == TTT_P1) board[i].p1 |= (1 << m);
+      else board[i].p2 |= (1 << m);
+      p = -p;
+    }
+  }
+
+  start = now();
+  do
+  {
+    for (uint16_t r=0; r<100; r++)
+    {
+      MD_TTT::evalBoards(board, BATCH, NULL, move, winner);
+      boards += BATCH;
+    }
+    time = now() - start;
+  } while (time < RUN_TIME);
+
+  report("evalBoards()", "board", boards, time);
+}
+
+int main(void)
+{
+  bool ok = true;
+
+  printf("MD_TTT host benchmark\n\n");
+
+  benchDoMove();
+  benchAutoMove("doAutoMove() heuristic", TTT_ENGINE_HEURISTIC, false);
+  benchAutoMove("doAutoMove() search", TTT_ENGINE_SEARCH, false);
+#if TTT_USE_HASH
+  benchAutoMove("doAutoMove() search + TT", TTT_ENGINE_SEARCH, true);
+#endif
+#if TTT_USE_TABLE
+  benchAutoMove("doAutoMove() table", TTT_ENGINE_TABLE, false);
+#endif
+  benchBatch();
+
+  printf("\n");
+  ok &= benchGames("games heuristic v heuristic", TTT_ENGINE_HEURISTIC, TTT_ENGINE_HEURISTIC, false);
+  ok &= benchGames("games search v search", TTT_ENGINE_SEARCH, TTT_ENGINE_SEARCH, true);
+  ok &= benchGames("games heuristic v search", TTT_ENGINE_HEURISTIC, TTT_ENGINE_SEARCH, false);
+
+  return(ok ? 0 : 1);
+}
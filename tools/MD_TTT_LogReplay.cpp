@@ -0,0 +1,181 @@
+// Move log writer and replay benchmark for the MD_TTT library
+//
+// Plays games between the heuristic auto player and a random player,
+// appending each game to a move log file with MD_TTT::writeLog(). The
+// file is then memory mapped and replayed with MD_TTT::replayLog(),
+// and also by playing each game through doMove() to check the results
+// agree and compare the speed. This is a host (PC) program for POSIX
+// systems, not an Arduino sketch. From the library folder
+//
+//   g++ -O2 -DTTT_USE_UNDO=1 -Isrc -o LogReplay tools/MD_TTT_LogReplay.cpp src/*.cpp
+//   ./LogReplay [-g games] [-f file]
+//
+//   -g  number of games to log (default 1000000)
+//   -f  the move log file (default ttt_moves.log)
+//
+// If the file already exists it is replayed without logging new games.
+//
+#include <MD_TTT.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#if !TTT_USE_UNDO
+#error "Build the library and this program with -DTTT_USE_UNDO=1"
+#endif
+
+static double now(void)
+// seconds from an arbitrary start
+{
+  return(std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static bool writeGames(const char *name, uint32_t games)
+// play the games and append them to the log file
+{
+  FILE *f = fopen(name, "wb");
+  MD_TTT T(NULL);
+  uint32_t rnd = 1;
+  uint8_t rec[TTT_LOG_MAX_SIZE];
+
+  if (f == NULL)
+    return(false);
+
+  T.setSeed(1);
+  for (uint32_t g=0; g<games; g++)
+  {
+    int8_t p = (g & 1) ? TTT_P2 : TTT_P1;   // the auto player goes first in odd games
+
+    T.setAutoPlayer(TTT_P2);
+    T.start();
+    while (!T.isGameOver())
+    {
+      uint8_t m = 0;
+
+      if (p != TTT_P2)
+      {
+        do
+        {
+          rnd ^= rnd << 13;
+          rnd ^= rnd >> 17;
+          rnd ^= rnd << 5;
+          m = rnd % TTT_BOARD_SIZE;
+        } while (T.getBoardPosition(m) != TTT_P0);
+      }
+      T.doMove(m, p, true);
+      p = -p;
+    }
+    fwrite(rec, T.writeLog(rec, sizeof(rec)), 1, f);
+  }
+  fclose(f);
+
+  return(true);
+}
+
+int main(int argc, char *argv[])
+{
+  const char *name = "ttt_moves.log";
+  uint32_t games = 1000000;
+  struct stat st;
+
+  for (int i=1; i<argc; i++)
+  {
+    if (strcmp(argv[i], "-g") == 0 && i+1 < argc) games = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-f") == 0 && i+1 < argc) name = argv[++i];
+    else
+    {
+      fprintf(stderr, "usage: %s [-g games] [-f file]\n", argv[0]);
+      return(1);
+    }
+  }
+
+  if (stat(name, &st) != 0)
+  {
+    double t = now();
+
+    if (!writeGames(name, games))
+    {
+      fprintf(stderr, "cannot write %s\n", name);
+      return(1);
+    }
+    printf("Logged %u games to %s in %.2f s\n", games, name, now() - t);
+  }
+
+  // map the log into memory
+  int fd = open(name, O_RDONLY);
+
+  if (fd < 0 || fstat(fd, &st) != 0 || st.st_size == 0)
+  {
+    fprintf(stderr, "cannot read %s\n", name);
+    return(1);
+  }
+
+  const uint8_t *log = (const uint8_t *)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+  if (log == MAP_FAILED)
+  {
+    fprintf(stderr, "cannot map %s\n", name);
+    return(1);
+  }
+
+  // fast replay, first to count the games and then to get the results
+  double t = now();
+  uint32_t count = MD_TTT::replayLog(log, st.st_size, NULL, 0);
+  double tCheck = now() - t;
+  std::vector<tttGameResult> result(count);
+
+  t = now();
+  MD_TTT::replayLog(log, st.st_size, result.data(), count);
+  double tReplay = now() - t;
+
+  uint32_t wins[3] = { 0, 0, 0 }, invalid = 0, bytes = 0;
+
+  for (uint32_t i=0; i<count; i++)
+  {
+    if (!result[i].valid) invalid++;
+    else wins[result[i].winner + 1]++;
+    bytes += result[i].length;
+  }
+
+  printf("%u games, %ld bytes (%.1f bytes/game), %u not valid", count, (long)st.st_size, (double)st.st_size / count, invalid);
+  if (bytes != (uint32_t)st.st_size) printf(", damaged after byte %u", bytes);
+  printf("\nP1 %u, draw %u, P2 %u\n\n", wins[TTT_P1 + 1], wins[TTT_P0 + 1], wins[TTT_P2 + 1]);
+  printf("replayLog() check only   %12.0f games/s\n", count / tCheck);
+  printf("replayLog() with results %12.0f games/s\n", count / tReplay);
+
+  // the same games through doMove(), checking the results agree
+  MD_TTT T(NULL);
+  uint32_t differ = 0;
+  const uint8_t *p = log;
+
+  t = now();
+  for (uint32_t i=0; i<count; i++)
+  {
+    int8_t player = (p[0] & 0x10) ? TTT_P2 : TTT_P1;
+
+    T.start();
+    for (uint8_t m=0; m<result[i].moves; m++)
+    {
+      T.doMove((p[TTT_LOG_HEADER + m/2] >> ((m & 1) ? 4 : 0)) & 0xf, player);
+      player = -player;
+    }
+    if (result[i].valid && (T.getGameWinner() != result[i].winner || T.isGameOver() != result[i].gameOver))
+      differ++;
+    p += result[i].length;
+  }
+  double tMove = now() - t;
+
+  printf("doMove() replay          %12.0f games/s\n", count / tMove);
+  printf("\nreplayLog() is %.1f times faster, %u results differ\n", tMove / tReplay, differ);
+
+  munmap((void *)log, st.st_size);
+  close(fd);
+
+  return(differ == 0 ? 0 : 1);
+}
@@ -0,0 +1,321 @@
+// Memory and speed of an MD_TTTPool against separate MD_TTT objects
+//
+// Hosts a large number of games, as a game server would, and makes
+// moves in games chosen at random, half by a random player and half by
+// the auto player. The games are held either as MD_TTT objects, each
+// allocated on the heap, or in an MD_TTTPool. For each the program
+// reports the memory for each game, the time for each move and, where
+// the operating system allows it, the cache misses for each move.
+//
+// It then advances every game by one move each tick, as a server game
+// loop would, first with doMove() and a callback for each move and then
+// with one doMoves() batch and one batch callback for each tick. The
+// batches are also run on several threads, with the games split among
+// one pool for each thread, as a pool is not shared between threads.
+// This is a host (PC) program for Linux, not an Arduino sketch. From
+// the library folder
+//
+//   g++ -O2 -pthread -Isrc -o PoolBench tools/MD_TTT_PoolBench.cpp src/*.cpp
+//   ./PoolBench [-g games] [-m moves] [-t threads]
+//
+//   -g  number of games (default 50000, at most 65534)
+//   -m  number of moves to time (default 10000000)
+//   -t  number of threads for the batches (default 4)
+//
+#include <MD_TTT.h>
+#include <MD_TTT_Pool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+static double now(void)
+// seconds from an arbitrary start
+{
+  return(std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static uint32_t xorshift(uint32_t &x)
+{
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+
+  return(x);
+}
+
+static int cacheCounter(void)
+// a counter for the cache misses of this process, or -1 if not allowed
+{
+  struct perf_event_attr pe;
+
+  memset(&pe, 0, sizeof(pe));
+  pe.type = PERF_TYPE_HARDWARE;
+  pe.size = sizeof(pe);
+  pe.config = PERF_COUNT_HW_CACHE_MISSES;
+  pe.disabled = 1;
+  pe.exclude_kernel = 1;
+  pe.exclude_hv = 1;
+
+  return((int)syscall(__NR_perf_event_open, &pe, 0, -1, -1, 0));
+}
+
+struct Measure
+{
+  int fd;
+  double start;
+
+  void begin(void)
+  {
+    fd = cacheCounter();
+    if (fd >= 0)
+    {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    start = now();
+  }
+
+  void end(const char *name, double bytes, uint32_t moves)
+  {
+    double time = now() - start;
+    long long misses = -1;
+
+    if (fd >= 0)
+    {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+      if (read(fd, &misses, sizeof(misses)) != sizeof(misses))
+        misses = -1;
+      close(fd);
+    }
+
+    printf("%-16s %8.1f bytes/game %8.1f ns/move ", name, bytes, time * 1e9 / moves);
+    if (misses >= 0)
+      printf("%8.2f cache misses/move\n", (double)misses / moves);
+    else
+      printf("    cache misses not available\n");
+  }
+};
+
+// The next player in each game is kept outside the game, the same for both.
+static std::vector<int8_t> turn;
+
+static void benchObjects(uint32_t games, uint32_t moves)
+{
+  std::vector<MD_TTT *> T(games);
+  size_t bytes = 0;
+  uint32_t rnd = 1;
+  Measure m;
+
+  for (uint32_t i=0; i<games; i++)
+  {
+    T[i] = new MD_TTT(NULL);
+    T[i]->setSeed(i);
+    T[i]->setAutoPlayer(TTT_P2);
+    T[i]->start();
+    turn[i] = TTT_P1;
+    bytes += malloc_usable_size(T[i]) + sizeof(size_t) + sizeof(MD_TTT *);  // with the heap header and the pointer
+  }
+
+  m.begin();
+  for (uint32_t n=0; n<moves; n++)
+  {
+    uint32_t g = xorshift(rnd) % games;
+    uint8_t cell = 0;
+
+    if (T[g]->isGameOver())
+    {
+      T[g]->start();
+      turn[g] = TTT_P1;
+    }
+    if (turn[g] == TTT_P1)
+    {
+      do
+        cell = xorshift(rnd) % TTT_BOARD_SIZE;
+      while (T[g]->getBoardPosition(cell) != TTT_P0);
+    }
+    T[g]->doMove(cell, turn[g], true);
+    turn[g] = -turn[g];
+  }
+  m.end("MD_TTT objects", (double)bytes / games, moves);
+
+  for (uint32_t i=0; i<games; i++)
+    delete T[i];
+}
+
+static void benchPool(uint32_t games, uint32_t moves)
+{
+  size_t size = (size_t)games * TTT_POOL_GAME_SIZE + 64;
+  void *mem = malloc(size);
+  MD_TTTPool P(mem, size);
+  std::vector<tttHandle> h(games);
+  uint32_t rnd = 1;
+  Measure m;
+
+  P.setSeed(1);
+  for (uint32_t i=0; i<games; i++)
+  {
+    h[i] = P.acquire();
+    P.setAutoPlayer(h[i], TTT_P2);
+    turn[i] = TTT_P1;
+  }
+
+  m.begin();
+  for (uint32_t n=0; n<moves; n++)
+  {
+    uint32_t g = xorshift(rnd) % games;
+    uint8_t cell = 0;
+
+    if (P.isGameOver(h[g]))
+    {
+      P.start(h[g]);
+      turn[g] = TTT_P1;
+    }
+    if (turn[g] == TTT_P1)
+    {
+      do
+        cell = xorshift(rnd) % TTT_BOARD_SIZE;
+      while (P.getBoardPosition(h[g], cell) != TTT_P0);
+    }
+    P.doMove(h[g], cell, turn[g], true);
+    turn[g] = -turn[g];
+  }
+  m.end("MD_TTTPool", (double)size / games + sizeof(tttHandle), moves);
+
+  free(mem);
+}
+
+static std::atomic<uint32_t> notified;
+
+static void moveHandler(tttHandle, uint8_t, int8_t)
+// stands in for the server sending each move to its players
+{
+  notified++;
+}
+
+static void batchHandler(const tttPoolMove *moves, uint16_t count)
+// stands in for the server sending all the moves for the tick
+{
+  uint32_t n = 0;
+
+  for (uint16_t i=0; i<count; i++)
+    if (moves[i].result != TTT_POOL_ERROR)
+      n++;
+  notified += n;
+}
+
+static void tickGames(uint32_t games, uint32_t ticks, uint32_t seed, bool batch)
+// Advance all the games in a pool of their own by one move each tick.
+{
+  size_t size = (size_t)games * TTT_POOL_GAME_SIZE + 64;
+  void *mem = malloc(size);
+  MD_TTTPool P(mem, size, moveHandler);
+  std::vector<tttPoolMove> mv(games);
+  uint32_t rnd = seed;
+
+  P.setSeed(seed);
+  if (batch)
+    P.setBatchHandler(batchHandler);
+  for (uint32_t i=0; i<games; i++)
+  {
+    mv[i].h = P.acquire();
+    mv[i].player = TTT_P1;
+    P.setAutoPlayer(mv[i].h, TTT_P2);
+  }
+
+  for (uint32_t t=0; t<ticks; t++)
+  {
+    // the players' moves for this tick
+    for (uint32_t i=0; i<games; i++)
+    {
+      if (P.isGameOver(mv[i].h))
+      {
+        P.start(mv[i].h);
+        mv[i].player = TTT_P1;
+      }
+      else if (t != 0)
+        mv[i].player = -mv[i].player;
+      mv[i].pos = 0;
+      if (mv[i].player == TTT_P1)
+      {
+        do
+          mv[i].pos = xorshift(rnd) % TTT_BOARD_SIZE;
+        while (P.getBoardPosition(mv[i].h, mv[i].pos) != TTT_P0);
+      }
+    }
+
+    if (batch)
+      P.doMoves(mv.data(), games);
+    else
+      for (uint32_t i=0; i<games; i++)
+        P.doMove(mv[i].h, mv[i].pos, mv[i].player);
+  }
+
+  free(mem);
+}
+
+static void benchTicks(uint32_t games, uint32_t moves, uint32_t threads, bool batch)
+{
+  uint32_t ticks = (moves + games - 1) / games;
+  std::vector<std::thread> T;
+  char name[32];
+  Measure m;
+
+  notified = 0;
+  m.begin();
+  if (threads <= 1)
+    tickGames(games, ticks, 1, batch);
+  else
+  {
+    for (uint32_t i=0; i<threads; i++)
+      T.push_back(std::thread(tickGames, games / threads + (i < games % threads ? 1 : 0), ticks, i + 1, batch));
+    for (uint32_t i=0; i<threads; i++)
+      T[i].join();
+  }
+
+  if (!batch)
+    snprintf(name, sizeof(name), "tick doMove");
+  else
+    snprintf(name, sizeof(name), "tick doMoves x%u", threads);
+  m.end(name, TTT_POOL_GAME_SIZE, notified);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t games = 50000;
+  uint32_t moves = 10000000;
+  uint32_t threads = 4;
+
+  for (int i=1; i<argc; i++)
+  {
+    if (strcmp(argv[i], "-g") == 0 && i+1 < argc) games = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-m") == 0 && i+1 < argc) moves = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-t") == 0 && i+1 < argc) threads = strtoul(argv[++i], NULL, 10);
+    else
+    {
+      fprintf(stderr, "usage: %s [-g games] [-m moves] [-t threads]\n", argv[0]);
+      return(1);
+    }
+  }
+  if (games == 0) games = 1;
+  if (games > TTT_POOL_NONE - 1) games = TTT_POOL_NONE - 1;
+
+  printf("MD_TTT pool benchmark, %u games, %u moves\n\n", games, moves);
+  turn.resize(games);
+  benchObjects(games, moves);
+  benchPool(games, moves);
+  benchTicks(games, moves, 1, false);
+  benchTicks(games, moves, 1, true);
+  if (threads > 1)
+    benchTicks(games, moves, threads, true);
+
+  return(0);
+}
@@ -0,0 +1,102 @@
+// Position space file for the MD_TTT library tools
+//
+// The layout of the file written by tools/MD_TTT_Enum.cpp, for programs
+// that read it. The file is a tttPosHeader followed by one tttPosRecord
+// for every board that can be reached in a game, in increasing order
+// of key, so a program can map the file into memory and find a board by
+// binary search with tttPosFind(). All the values are stored in the byte
+// order of the host that wrote the file (little endian on x86 and ARM).
+//
+// The key of a board is the sum for each cell i of 3^i times 0 (empty),
+// 1 (TTT_P1) or 2 (TTT_P2), so the empty board is key 0. This is not the
+// key of the perfect play table, which is seen by the player to move.
+//
+#ifndef MD_TTT_POSITIONS_H
+#define MD_TTT_POSITIONS_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define TTT_POS_MAGIC    "MDTTTPOS" ///< the first 8 bytes of the file
+#define TTT_POS_VERSION  1          ///< the version of the layout
+
+// tttPosRecord status bits
+#define TTT_POS_TO_P1    0x01  ///< TTT_P1 is to move
+#define TTT_POS_TO_P2    0x02  ///< TTT_P2 is to move
+#define TTT_POS_WIN_P1   0x04  ///< game over, TTT_P1 has won
+#define TTT_POS_WIN_P2   0x08  ///< game over, TTT_P2 has won
+#define TTT_POS_DRAW     0x10  ///< game over, the board is full with no winner
+#define TTT_POS_CANON    0x20  ///< the key is the smallest of its rotations and reflections
+
+/**
+ * The file header, with the counts for the whole position space.
+ */
+struct tttPosHeader
+{
+  char     magic[8];      ///< TTT_POS_MAGIC, not terminated
+  uint16_t version;       ///< TTT_POS_VERSION
+  uint16_t recordSize;    ///< sizeof(tttPosRecord)
+  uint32_t positions;     ///< the boards that can be reached, one record each
+  uint32_t canonical;     ///< the boards that differ by more than a rotation or reflection
+  uint32_t terminal;      ///< the boards where the game is over
+  uint32_t terminalCanon; ///< the terminal boards that differ by more than a rotation or reflection
+  uint32_t nodes;         ///< the nodes in the game tree, every move sequence including the empty board
+  uint32_t games;         ///< the leaves of the game tree, every complete game
+  uint32_t gameWins[3];   ///< the games won by TTT_P2, drawn and won by TTT_P1 (winner + 1)
+  uint32_t gameLength[10]; ///< the games ending after each number of moves
+  uint32_t trials;        ///< the heuristic games played from each position
+  uint32_t heurTrials[3]; ///< all the heuristic games lost, drawn and won
+  uint32_t heurWorse;     ///< positions where the heuristic did worse than the game value at least once
+  uint32_t reserved[3];   ///< zero
+};
+
+/**
+ * One board that can be reached in a game.
+ */
+struct tttPosRecord
+{
+  uint16_t key;       ///< the board key
+  uint16_t canon;     ///< the smallest key of the rotations and reflections of the board
+  uint32_t paths;     ///< the move sequences from the empty board that reach it
+  uint32_t games;     ///< the complete games that pass through it
+  uint16_t best;      ///< the cells (bit 0 = cell 0) of the moves with the best game value
+  uint8_t  status;    ///< TTT_POS_* bits
+  int8_t   value;     ///< the game value for the player to move, TTT_VAL_LOSS/DRAW/WIN, or 0 if the game is over
+  uint8_t  heur[3];   ///< heuristic games from here lost, drawn and won against a perfect opponent
+  uint8_t  moves;     ///< the number of moves made
+};
+
+static_assert(sizeof(tttPosHeader) == 120, "tttPosHeader layout");
+static_assert(sizeof(tttPosRecord) == 20, "tttPosRecord layout");
+
+inline bool tttPosValid(const void *file, size_t size)
+// true if the mapped file is a position space file this code can read
+{
+  const tttPosHeader *h = (const tttPosHeader *)file;
+
+  return(size >= sizeof(tttPosHeader) && memcmp(h->magic, TTT_POS_MAGIC, sizeof(h->magic)) == 0 &&
+    h->version == TTT_POS_VERSION && h->recordSize == sizeof(tttPosRecord) &&
+    size >= sizeof(tttPosHeader) + (size_t)h->positions * sizeof(tttPosRecord));
+}
+
+inline const tttPosRecord *tttPosFind(const void *file, uint16_t key)
+// the record for the board key in a mapped file, or NULL if the board cannot be reached
+{
+  const tttPosHeader *h = (const tttPosHeader *)file;
+  const tttPosRecord *r = (const tttPosRecord *)(h + 1);
+  uint32_t lo = 0, hi = h->positions;
+
+  while (lo < hi)
+  {
+    uint32_t mid = (lo + hi) / 2;
+
+    if (r[mid].key < key)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return(lo < h->positions && r[lo].key == key ? &r[lo] : NULL);
+}
+
+#endif
@@ -0,0 +1,205 @@
+// Bytes sent to redraw the board, whole board against changed cells
+//
+// Plays random games against the auto player and, after every change
+// to the board, draws it as the MD_TTT_Console example does: the whole
+// board, or only the cells marked by getDirty() using ANSI escape codes.
+// The bytes are counted and the changed cells are also run through a
+// small terminal emulator to check they leave the same board on the
+// screen as the whole board. This is a host (PC) program, not an
+// Arduino sketch. From the library folder
+//
+//   g++ -O2 -Isrc -o Redraw tools/MD_TTT_Redraw.cpp src/*.cpp
+//   ./Redraw [-n games]
+//
+//   -n  number of games (default 10000)
+//
+#include <MD_TTT.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+
+#define ESC "\x1b"
+
+static const char player[] = { 'O', ' ', 'X' };
+
+// The screen of an ANSI terminal, only the escape codes sent by
+// displayDelta() are understood.
+struct Terminal
+{
+  char screen[6][32];
+  int row, col, savedRow, savedCol;
+
+  Terminal(void) : row(1), col(1), savedRow(1), savedCol(1)
+  {
+    memset(screen, ' ', sizeof(screen));
+  }
+
+  void write(const std::string &s)
+  {
+    for (size_t i=0; i<s.size(); i++)
+    {
+      if (s[i] == '\r') col = 1;
+      else if (s[i] == '\n') row++;
+      else if (s[i] != '\x1b')
+      {
+        if (row >= 1 && row <= 5 && col >= 1 && col <= 31)
+          screen[row][col] = s[i];
+        col++;
+      }
+      else if (s[i+1] == '7') { savedRow = row; savedCol = col; i++; }
+      else if (s[i+1] == '8') { row = savedRow; col = savedCol; i++; }
+      else  // ESC [ n C or ESC [ r ; c H
+      {
+        int a = 0, b = 0;
+
+        i += 2;
+        while (s[i] >= '0' && s[i] <= '9') a = a * 10 + (s[i++] - '0');
+        if (s[i] == ';')
+          for (i++; s[i] >= '0' && s[i] <= '9'; i++) b = b * 10 + (s[i] - '0');
+        if (s[i] == 'C') col += a;
+        else if (s[i] == 'H') { row = a; col = b; }
+      }
+    }
+  }
+};
+
+static std::string boardLine(MD_TTT &T, uint8_t i, uint8_t j, uint8_t k)
+// one line of the board as drawn by the example
+{
+  std::string s = " ";
+  uint8_t c[3] = { i, j, k };
+
+  for (uint8_t n=0; n<3; n++)
+  {
+    s += player[T.getBoardPosition(c[n]) + 1];
+    s += (n < 2 ? " | " : "    ");
+  }
+  for (uint8_t n=0; n<3; n++)
+  {
+    s += (T.getBoardPosition(c[n]) == TTT_P0) ? CELL_ID(c[n]) : ' ';
+    if (n < 2) s += " | ";
+  }
+
+  return(s);
+}
+
+static std::string displayBoard(MD_TTT &T)
+// the whole board, as displayBoard() in the example
+{
+  std::string s;
+
+  s += "\n" + boardLine(T, 0, 1, 2);
+  s += "\n---+---+---  ---+---+---";
+  s += "\n" + boardLine(T, 3, 4, 5);
+  s += "\n---+---+---  ---+---+---";
+  s += "\n" + boardLine(T, 6, 7, 8);
+  s += "\r\n";
+
+  return(s);
+}
+
+static std::string displayDelta(MD_TTT &T)
+// the changed cells, as displayDelta() in the example
+{
+  uint16_t dirty = T.getDirty();
+  std::string s = ESC "7";
+  char buf[16];
+
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+  {
+    if (!(dirty & (1 << i)))
+      continue;
+
+    int8_t p = T.getBoardPosition(i);
+
+    snprintf(buf, sizeof(buf), ESC "[%d;%dH", 1 + 2*(i/3), 2 + 4*(i%3));
+    s += buf;
+    s += player[p + 1];
+    s += ESC "[12C";
+    s += (p == TTT_P0) ? CELL_ID(i) : ' ';
+  }
+  s += ESC "8";
+
+  return(s);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t games = 10000;
+  uint32_t rnd = 1;
+  uint64_t moves = 0, updates = 0, fullBytes = 0, deltaBytes = 0, bad = 0;
+  uint16_t boardGen = 0;
+  MD_TTT T(NULL);
+  Terminal term;
+
+  for (int i=1; i<argc; i++)
+  {
+    if (strcmp(argv[i], "-n") == 0 && i+1 < argc) games = strtoul(argv[++i], NULL, 10);
+    else
+    {
+      fprintf(stderr, "usage: %s [-n games]\n", argv[0]);
+      return(1);
+    }
+  }
+
+  // the empty grid drawn by setup() in the example
+  term.write("   |   |        |   |  \r\n---+---+---  ---+---+---\r\n");
+  term.write("   |   |        |   |  \r\n---+---+---  ---+---+---\r\n");
+  term.write("   |   |        |   |  ");
+
+  T.setSeed(1);
+  T.setAutoPlayer(TTT_P2);
+  for (uint32_t g=0; g<games; g++)
+  {
+    int8_t p = TTT_P1;
+
+    T.start();
+    while (true)
+    {
+      // draw the board if it has changed, as updateDisplay() in the example
+      if (T.getGeneration() != boardGen)
+      {
+        std::string full = displayBoard(T);
+        std::string delta = displayDelta(T);
+
+        boardGen = T.getGeneration();
+        T.clearDirty();
+        updates++;
+        fullBytes += full.size();
+        deltaBytes += delta.size();
+
+        term.write(delta);
+        for (uint8_t r=0; r<3; r++)
+          if (std::string(&term.screen[1 + 2*r][1], 23) != boardLine(T, 3*r, 3*r+1, 3*r+2))
+            bad++;
+      }
+
+      if (T.isGameOver())
+        break;
+
+      uint8_t m = 0;
+
+      if (p == TTT_P1)
+      {
+        do
+        {
+          rnd ^= rnd << 13;
+          rnd ^= rnd >> 17;
+          rnd ^= rnd << 5;
+          m = rnd % TTT_BOARD_SIZE;
+        } while (T.getBoardPosition(m) != TTT_P0);
+      }
+      T.doMove(m, p, true);
+      moves++;
+      p = -p;
+    }
+  }
+
+  printf("%u games, %llu moves, %llu board updates\n", games, (unsigned long long)moves, (unsigned long long)updates);
+  printf("whole board   %6.1f bytes/move\n", (double)fullBytes / moves);
+  printf("changed cells %6.1f bytes/move\n", (double)deltaBytes / moves);
+  printf("screen mismatches %llu\n", (unsigned long long)bad);
+
+  return(bad != 0);
+}
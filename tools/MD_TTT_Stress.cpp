@@ -0,0 +1,156 @@
+// Multi-threaded stress test for the MD_TTT library
+//
+// Checks that MD_TTT objects used at the same time from different
+// threads do not affect each other (see Thread Safety in MD_TTT.h).
+// Each thread has its own MD_TTT object and transposition table and
+// plays the same list of seeded games, mixing the heuristic and search
+// engines with random moves. The moves and result of every game are
+// compared with those of the same games played first on one thread, and
+// any difference is reported.
+// This is a host (PC) program, not an Arduino sketch. From the library
+// folder
+//
+//   g++ -O2 -pthread -DTTT_USE_HASH=1 -Isrc -o Stress tools/MD_TTT_Stress.cpp src/*.cpp
+//   ./Stress [-t threads] [-g games]
+//
+//   -t  number of threads (default 8, or the processor cores if more)
+//   -g  number of games for each thread (default 20000)
+//
+// The program exits with a non-zero status if any thread's games differ.
+// It is also run by ctest in the CMake build, and can be built with
+// -fsanitize=thread to look for data races.
+//
+#include <MD_TTT.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+static uint32_t xorshift(uint32_t &x)
+{
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+
+  return(x);
+}
+
+static uint64_t playGame(MD_TTT &T, uint32_t g)
+// Play game number g and return its moves, 4 bits each in the order
+// they were made, and the winner in the top bits.
+{
+  uint32_t rnd = g * 0x9e3779b9UL + 1;
+  uint8_t  engine = (g % 3 == 2 ? TTT_ENGINE_SEARCH : TTT_ENGINE_HEURISTIC);
+  int8_t   autoP = (g & 1) ? TTT_P1 : TTT_P2;
+  bool     random = (g % 3 == 1);   // else both players are auto players
+  uint16_t board = 0;
+  uint64_t record = 0;
+  int8_t   p = TTT_P1;
+
+  T.setSeed(g + 1);
+  T.setAutoPlayer(autoP, engine);
+  T.start();
+  for (uint8_t n=0; !T.isGameOver(); n++)
+  {
+    uint8_t cell = 0;
+
+    if (p != autoP)
+    {
+      if (random)
+      {
+        do
+          cell = xorshift(rnd) % TTT_BOARD_SIZE;
+        while (board & (1 << cell));
+      }
+      else
+        T.setAutoPlayer(p, TTT_ENGINE_HEURISTIC);
+    }
+    T.doMove(cell, p, true);
+    if (p != autoP && !random)
+      T.setAutoPlayer(autoP, engine);
+
+    // find the cell the move was made in
+    for (cell=0; cell<TTT_BOARD_SIZE; cell++)
+      if (!(board & (1 << cell)) && T.getBoardPosition(cell) != TTT_P0)
+        break;
+    board |= (1 << cell);
+    record |= (uint64_t)cell << (4 * n);
+    p = -p;
+  }
+
+  return(record | ((uint64_t)(T.getGameWinner() + 1) << 60));
+}
+
+static void playGames(uint32_t games, std::vector<uint64_t> &result)
+{
+  static thread_local tttTransEntry tt[256];
+  MD_TTT T(NULL);
+
+#if TTT_USE_HASH
+  T.setTransTable(tt, sizeof(tt));
+#endif
+  result.resize(games);
+  for (uint32_t g=0; g<games; g++)
+    result[g] = playGame(T, g);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t threads = std::thread::hardware_concurrency();
+  uint32_t games = 20000;
+
+  if (threads < 8) threads = 8;
+  for (int i=1; i<argc; i++)
+  {
+    if (strcmp(argv[i], "-t") == 0 && i+1 < argc) threads = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-g") == 0 && i+1 < argc) games = strtoul(argv[++i], NULL, 10);
+    else
+    {
+      fprintf(stderr, "usage: %s [-t threads] [-g games]\n", argv[0]);
+      return(1);
+    }
+  }
+  if (threads == 0) threads = 1;
+
+  std::vector<uint64_t> expected;
+  std::vector<std::vector<uint64_t> > result(threads);
+  std::vector<std::thread> pool;
+  std::atomic<uint32_t> ready(0);
+  uint32_t bad = 0;
+
+  playGames(games, expected);
+
+  // start all the threads together so their games overlap
+  for (uint32_t n=0; n<threads; n++)
+  {
+    pool.push_back(std::thread([&, n]()
+    {
+      ready++;
+      while (ready < threads)
+        std::this_thread::yield();
+      playGames(games, result[n]);
+    }));
+  }
+  for (uint32_t n=0; n<threads; n++)
+    pool[n].join();
+
+  for (uint32_t n=0; n<threads; n++)
+  {
+    uint32_t diff = 0;
+
+    for (uint32_t g=0; g<games; g++)
+      if (result[n][g] != expected[g])
+      {
+        if (diff == 0)
+          printf("thread %u game %u differs from the single thread game\n", n, g);
+        diff++;
+      }
+    bad += diff;
+  }
+
+  printf("MD_TTT stress test: %u threads, %u games each, %u differ\n", threads, games, bad);
+
+  return(bad == 0 ? 0 : 1);
+}
@@ -0,0 +1,134 @@
+// Perfect play table generator for the MD_TTT library
+//
+// Solves every TicTacToe board by negamax search and writes the table
+// used by the MD_TTT library auto player engine TTT_ENGINE_TABLE.
+// This is a host (PC) program, not an Arduino sketch. To regenerate the
+// table, from the library folder
+//
+//   g++ -O2 -o TableGen tools/MD_TTT_TableGen.cpp
+//   ./TableGen > src/MD_TTT_Table.cpp
+//
+// The table is indexed by the base-3 key of the board as seen by the
+// player about to move. Cell i contributes 3^i times 0 (empty), 1 (the
+// player to move) or 2 (the opponent). Each entry is one byte
+// - bits 0-3 are the best move [0..8], or 0xf if the game is over.
+// - bits 4-5 are the game value for the player to move with perfect play
+//   from both sides (0 = loss, 1 = draw, 2 = win).
+// Boards that cannot occur in a game are set to 0xff.
+//
+#include <stdio.h>
+#include <stdint.h>
+
+#define BOARD_SIZE  9
+#define TABLE_SIZE  19683   // 3^9
+
+// The cells in each winning line as a bitboard mask
+static const uint16_t wlm[] =
+{
+  0b100010001, 0b000000111, 0b000111000, 0b111000000,
+  0b001001001, 0b010010010, 0b100100100, 0b001010100
+};
+
+static uint8_t table[TABLE_SIZE];
+static bool    solved[TABLE_SIZE];
+static int8_t  score[TABLE_SIZE];
+
+bool isWin(uint16_t b)
+// true if the bitboard has a complete line
+{
+  for (uint8_t i=0; i<sizeof(wlm)/sizeof(wlm[0]); i++)
+    if ((b & wlm[i]) == wlm[i])
+      return(true);
+
+  return(false);
+}
+
+uint16_t boardKey(uint16_t own, uint16_t opp)
+// base-3 key for the board from the point of view of the player to move
+{
+  uint16_t key = 0;
+
+  for (int8_t i=BOARD_SIZE-1; i>=0; i--)
+  {
+    key *= 3;
+    if (own & (1 << i)) key += 1;
+    else if (opp & (1 << i)) key += 2;
+  }
+
+  return(key);
+}
+
+int8_t solve(uint16_t own, uint16_t opp)
+// Negamax score for the player to move. A win is scored higher the
+// sooner it happens (and a loss the later) so the chosen moves finish
+// the game as quickly as possible.
+{
+  uint16_t key = boardKey(own, opp);
+  uint16_t empty = ~(own | opp) & 0x1ff;
+  int8_t   best = -100;
+  uint8_t  bestMove = 0xf;
+
+  if (solved[key])
+    return(score[key]);
+
+  if (isWin(opp))
+    best = -(1 + __builtin_popcount(empty));  // the opponent has just won
+  else if (empty == 0)
+    best = 0;                                 // draw
+  else
+  {
+    for (uint8_t i=0; i<BOARD_SIZE; i++)
+    {
+      if (empty & (1 << i))
+      {
+        int8_t s = -solve(opp, own | (1 << i));
+
+        if (s > best)
+        {
+          best = s;
+          bestMove = i;
+        }
+      }
+    }
+  }
+
+  solved[key] = true;
+  score[key] = best;
+  table[key] = bestMove | ((best > 0 ? 2 : (best == 0 ? 1 : 0)) << 4);
+
+  return(best);
+}
+
+int main(void)
+{
+  uint16_t count = 0;
+
+  for (uint16_t i=0; i<TABLE_SIZE; i++)
+    table[i] = 0xff;
+
+  // Solve from the empty board. Either player may start a game, but the
+  // table is from the point of view of the player to move, so this also
+  // covers the games started by the other player.
+  solve(0, 0);
+
+  for (uint16_t i=0; i<TABLE_SIZE; i++)
+    if (table[i] != 0xff) count++;
+
+  printf("// MD_TTT perfect play table - %u reachable boards\n", count);
+  printf("//\n");
+  printf("// Generated by tools/MD_TTT_TableGen.cpp - DO NOT EDIT.\n");
+  printf("// See the generator for a description of the table format.\n");
+  printf("//\n");
+  printf("#include <MD_TTT.h>\n\n");
+  printf("#if TTT_USE_TABLE\n\n");
+  printf("extern const uint8_t TTT_perfectTable[%u] PROGMEM =\n{", TABLE_SIZE);
+  for (uint16_t i=0; i<TABLE_SIZE; i++)
+  {
+    if (i % 16 == 0) printf("\n ");
+    printf(" 0x%02x%s", table[i], (i == TABLE_SIZE-1) ? "" : ",");
+  }
+  printf("\n};\n\n");
+  printf("#endif\n");
+
+  return(0);
+}
@@ -0,0 +1,1075 @@
+// Unit tests for the MD_TTT library on a host computer
+//
+// Checks the behaviour of the game engine: moves, wins and draws, the
+// auto player engines, undo and redo, the board hash, batch evaluation,
+// move analysis, changed cells, the game pool and the m,n,k game engine.
+// Each failed check is printed with its line number.
+// This is a host (PC) program, not an Arduino sketch. It is the test
+// target of the CMake build (see CMakeLists.txt), or from the library
+// folder
+//
+//   g++ -O2 -Isrc -o Test tools/MD_TTT_Test.cpp src/*.cpp
+//   ./Test
+//
+// The checks for undo and redo, saving games, move logs and the event
+// queue need the library built with TTT_USE_UNDO and TTT_USE_EVENTS set
+// to 1, as in the md_ttt_test_full target. The checks for the perfect 
+// play table, the opening book and time-sliced moves need TTT_USE_TABLE, 
+// TTT_USE_BOOK and TTT_USE_STEP as well, as in md_ttt_test_engines.
+//
+// The program exits with a non-zero status if any check fails.
+//
+#include <MD_TTT.h>
+#include <MD_TTT_Pool.h>
+#include <MD_TTT_MNK.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t checks = 0, failures = 0;
+
+#define CHECK(c)  check((c), #c, __LINE__)
+
+static void check(bool ok, const char *text, int line)
+{
+  checks++;
+  if (!ok)
+  {
+    failures++;
+    printf("FAILED line %d: %s\n", line, text);
+  }
+}
+
+static uint32_t xorshift(uint32_t &x)
+{
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+
+  return(x);
+}
+
+static uint8_t randomCell(MD_TTT &T, uint32_t &rnd)
+// an empty cell on the board
+{
+  uint8_t m;
+
+  do
+    m = xorshift(rnd) % TTT_BOARD_SIZE;
+  while (T.getBoardPosition(m) != TTT_P0);
+
+  return(m);
+}
+
+static void play(MD_TTT &T, const char *moves)
+// Make the moves in the string, cells 'a' to 'i', players alternating
+// from TTT_P1, with no auto player
+{
+  int8_t p = TTT_P1;
+
+  T.setAutoPlayer(TTT_P0);
+  T.start();
+  for (; *moves != '\0'; moves++, p = -p)
+    T.doMove(*moves - 'a', p, true);
+}
+
+static int8_t randomPosition(MD_TTT &T, uint8_t n, uint32_t &rnd)
+// Make n random moves from the start, fewer if the game ends first, and
+// return the player to move next
+{
+  int8_t p = TTT_P1;
+
+  play(T, "");
+  for (uint8_t i=0; i<n && !T.isGameOver(); i++, p = -p)
+    T.doMove(randomCell(T, rnd), p, true);
+
+  return(p);
+}
+
+static uint8_t autoMove(MD_TTT &T, int8_t p, uint8_t engine)
+// Make the auto player move for p with the engine and return the cell
+{
+  uint16_t before = 0;
+
+  for (uint8_t k=0; k<TTT_BOARD_SIZE; k++)
+    if (T.getBoardPosition(k) != TTT_P0) before |= (1 << k);
+
+  T.setAutoPlayer(p, engine);
+  T.doMove(0, p, true);
+  T.setAutoPlayer(TTT_P0);
+
+  for (uint8_t k=0; k<TTT_BOARD_SIZE; k++)
+    if (T.getBoardPosition(k) != TTT_P0 && !(before & (1 << k)))
+      return(k);
+
+  return(0xff);
+}
+
+static int8_t moveValues(MD_TTT &T, int8_t p, int8_t *value)
+// Put the game value of each move for p into value, by cell, and 
+// return the best of them
+{
+  tttMoveInfo m[TTT_BOARD_SIZE];
+  uint8_t n = T.analyze(p, m, TTT_BOARD_SIZE, true);
+
+  for (uint8_t i=0; i<n; i++)
+    value[m[i].cell] = m[i].value;
+
+  return(n == 0 ? TTT_VAL_UNKNOWN : m[0].value);
+}
+
+static void testMoves(void)
+{
+  MD_TTT T(NULL);
+
+  CHECK(T.start());
+  CHECK(!T.isGameOver());
+  CHECK(T.getMoveCount() == 0);
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+    CHECK(T.getBoardPosition(i) == TTT_P0);
+
+  CHECK(T.doMove(4, TTT_P1));
+  CHECK(T.getBoardPosition(4) == TTT_P1);
+  CHECK(!T.doMove(4, TTT_P2));              // occupied
+  CHECK(!T.doMove(TTT_BOARD_SIZE, TTT_P2)); // off the board
+  CHECK(!T.doMove(0, TTT_P0));              // not a player
+  CHECK(!T.doMove(0, 2));
+  CHECK(T.getMoveCount() == 1);
+  CHECK(T.getBoardPosition(TTT_BOARD_SIZE) == TTT_P0);
+}
+
+static bool hasLine(uint16_t b)
+{
+  static const uint16_t lines[] = { 0x111, 0x007, 0x038, 0x1c0, 0x049, 0x092, 0x124, 0x054 };
+
+  for (uint8_t i=0; i<ARRAY_SIZE(lines); i++)
+    if ((b & lines[i]) == lines[i])
+      return(true);
+
+  return(false);
+}
+
+static void testWins(void)
+{
+  // the cells of each winning line, in TTT_WL_* order
+  static const char *lines[TTT_WIN_LINES] = { "aei", "abc", "def", "ghi", "adg", "beh", "cfi", "ceg" };
+  MD_TTT T(NULL);
+
+  for (uint8_t l=0; l<TTT_WIN_LINES; l++)
+  {
+    for (int8_t winner=TTT_P2; winner<=TTT_P1; winner+=2)
+    {
+      int8_t p = TTT_P1;
+      uint8_t n = 0;
+      uint16_t other = 0;
+
+      // The winner takes the line, the other player the first cells off 
+      // the line that do not make a line of their own.
+      T.start();
+      while (!T.isGameOver())
+      {
+        uint8_t cell = 0;
+
+        if (p == winner)
+          cell = lines[l][n++] - 'a';
+        else
+        {
+          while (strchr(lines[l], 'a' + cell) != NULL || T.getBoardPosition(cell) != TTT_P0 || hasLine(other | (1 << cell)))
+            cell++;
+          other |= (1 << cell);
+        }
+        CHECK(T.doMove(cell, p, true));
+        p = -p;
+      }
+      CHECK(T.getGameWinner() == winner);
+      CHECK(T.getWinLine() == l);
+    }
+  }
+
+  // a drawn game
+  play(T, "aebcfdgih");
+  CHECK(T.isGameOver());
+  CHECK(T.getGameWinner() == TTT_P0);
+  CHECK(T.getWinLine() == 0xff);
+  CHECK(T.getMoveCount() == TTT_BOARD_SIZE);
+}
+
+static void testHeuristic(void)
+{
+  MD_TTT T(NULL);
+
+  // takes a win ...
+  play(T, "adbe");
+  T.setAutoPlayer(TTT_P1);
+  CHECK(T.doMove(0, TTT_P1, true));
+  CHECK(T.getBoardPosition(2) == TTT_P1);
+  CHECK(T.getGameWinner() == TTT_P1);
+  CHECK(T.getAutoMode() == TTT_MODE_WIN);
+
+  // ... and blocks one
+  play(T, "aeb");
+  T.setAutoPlayer(TTT_P2);
+  CHECK(T.doMove(0, TTT_P2, true));
+  CHECK(T.getBoardPosition(2) == TTT_P2);
+  CHECK(!T.isGameOver());
+
+  CHECK(!T.setAutoPlayer(2));
+  CHECK(!T.setAutoPlayer(TTT_P1, 0xff));
+  CHECK(T.getAutoPlayer() == TTT_P2);
+}
+
+static void testSearch(void)
+// The search engine never loses, whoever moves first
+{
+  MD_TTT T(NULL);
+  uint32_t rnd = 1;
+  uint32_t lost = 0;
+
+#if TTT_USE_HASH
+  static tttTransEntry tt[256];
+
+  T.setTransTable(tt, sizeof(tt));
+#endif
+  for (uint16_t g=0; g<400; g++)
+  {
+    int8_t engine = (g & 1) ? TTT_P1 : TTT_P2;
+    int8_t p = TTT_P1;
+
+    T.setAutoPlayer(engine, TTT_ENGINE_SEARCH);
+    T.start();
+    while (!T.isGameOver())
+    {
+      T.doMove(p == engine ? 0 : randomCell(T, rnd), p, true);
+      p = -p;
+    }
+    if (T.getGameWinner() == -engine)
+      lost++;
+  }
+  CHECK(lost == 0);
+
+  // it blocks the top row
+  play(T, "aib");
+  T.setAutoPlayer(TTT_P2, TTT_ENGINE_SEARCH);
+  T.doMove(0, TTT_P2, true);
+  CHECK(T.getBoardPosition(2) == TTT_P2);
+}
+
+#if TTT_USE_UNDO
+static void testUndo(void)
+{
+  MD_TTT T(NULL);
+  uint8_t before[TTT_SERIAL_SIZE], after[TTT_SERIAL_SIZE];
+
+  play(T, "aeb");
+  T.serialize(before, sizeof(before));
+  CHECK(T.doMove(2, TTT_P2, true));
+  CHECK(T.undoMove(true));
+  T.serialize(after, sizeof(after));
+  CHECK(memcmp(before + TTT_SER_P1, after + TTT_SER_P1, TTT_SER_MOVETOP - TTT_SER_P1) == 0);
+  CHECK(T.getBoardPosition(2) == TTT_P0);
+
+  // a win is taken back
+  play(T, "adbec");
+  CHECK(T.getGameWinner() == TTT_P1);
+  CHECK(T.undoMove(true));
+  CHECK(!T.isGameOver());
+  CHECK(T.getGameWinner() == TTT_P0);
+  CHECK(T.getWinLine() == 0xff);
+  CHECK(T.redoMove(true));
+  CHECK(T.getGameWinner() == TTT_P1);
+  CHECK(T.getWinLine() == TTT_WL_H1);
+  CHECK(!T.redoMove(true));
+
+  T.start();
+  CHECK(!T.undoMove(true));
+}
+
+static void testSerialize(void)
+// Random games, some played on after a win and some with moves to redo, 
+// restore to a game that plays on the same way
+{
+  MD_TTT T(NULL), U(NULL);
+  uint8_t a[TTT_SERIAL_SIZE], b[TTT_SERIAL_SIZE];
+  uint32_t rnd = 7;
+  uint32_t bad = 0;
+
+  for (uint32_t g=0; g<50000; g++)
+  {
+    uint8_t n = xorshift(rnd) % (TTT_BOARD_SIZE + 1);
+    int8_t p = (g & 1) ? TTT_P1 : TTT_P2;
+
+    T.setSeed(g + 1);
+    T.setAutoPlayer(-p, (g & 2) ? TTT_ENGINE_SEARCH : TTT_ENGINE_HEURISTIC);
+    T.start();
+    for (uint8_t i=0; i<n; i++, p = -p)
+      T.doMove(randomCell(T, rnd), p, true);
+    for (uint8_t i=xorshift(rnd) % 3; i>0; i--)
+      T.undoMove(true);
+
+    T.serialize(a, sizeof(a));
+    if (!U.deserialize(a, sizeof(a), true)) { bad++; continue; }
+    U.serialize(b, sizeof(b));
+    if (memcmp(a, b, sizeof(a)) != 0 || U.getBoardHash() != T.getBoardHash()) { bad++; continue; }
+
+    // both take back and redo the same way, and the auto player moves the same
+    while (T.undoMove(true))
+    {
+      U.undoMove(true);
+      T.serialize(a, sizeof(a));
+      U.serialize(b, sizeof(b));
+      if (memcmp(a, b, sizeof(a)) != 0) { bad++; break; }
+    }
+    while (T.redoMove(true))
+      U.redoMove(true);
+    if (!T.isGameOver())
+    {
+      T.doMove(0, T.getAutoPlayer(), true);
+      U.doMove(0, U.getAutoPlayer(), true);
+    }
+    T.serialize(a, sizeof(a));
+    U.serialize(b, sizeof(b));
+    if (memcmp(a, b, sizeof(a)) != 0) bad++;
+  }
+  CHECK(bad == 0);
+}
+
+static void testSerializeInvalid(void)
+// Data that does not match the moves is rejected and leaves the game alone
+{
+  MD_TTT T(NULL), U(NULL);
+  uint8_t good[TTT_SERIAL_SIZE], buf[TTT_SERIAL_SIZE], u[TTT_SERIAL_SIZE];
+
+  play(T, "adbec");   // TTT_P1 wins the top row
+  T.serialize(good, sizeof(good));
+  CHECK(U.deserialize(good, sizeof(good), true));
+  U.serialize(u, sizeof(u));
+  CHECK(memcmp(good, u, sizeof(u)) == 0);
+
+  memcpy(buf, good, sizeof(buf));
+  buf[TTT_SER_WINNER] = 5;
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+
+  memcpy(buf, good, sizeof(buf));
+  buf[TTT_SER_WINNER] = (uint8_t)TTT_P2;
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+
+  memcpy(buf, good, sizeof(buf));
+  buf[TTT_SER_WINLINE] = TTT_WL_H2;
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+
+  memcpy(buf, good, sizeof(buf));
+  buf[TTT_SER_WINLINE] = 0xff;
+  buf[TTT_SER_WINNER] = (uint8_t)TTT_P0;
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+
+  memcpy(buf, good, sizeof(buf));
+  buf[TTT_SER_FLAGS] = 0;
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+
+  memcpy(buf, good, sizeof(buf));
+  buf[TTT_SER_MOVES+4] &= ~0x80;  // the winning move
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+
+  memcpy(buf, good, sizeof(buf));
+  buf[TTT_SER_MOVES+1] |= 0x80;   // not a winning move
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+
+  memcpy(buf, good, sizeof(buf));
+  buf[TTT_SER_MOVES+7] = 8;       // beyond the top of the stack
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+
+  memcpy(buf, good, sizeof(buf));
+  buf[TTT_SER_ENGINE] = 0xff;
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+#if !TTT_USE_TABLE
+  buf[TTT_SER_ENGINE] = TTT_ENGINE_TABLE;
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+#endif
+
+  // a game still in play is not over
+  play(T, "ae");
+  T.serialize(buf, sizeof(buf));
+  buf[TTT_SER_FLAGS] = 1;
+  CHECK(!U.deserialize(buf, sizeof(buf), true));
+
+  U.serialize(buf, sizeof(buf));
+  CHECK(memcmp(buf, u, sizeof(u)) == 0);
+}
+
+static void playAuto(MD_TTT &T, bool restart)
+// TTT_P1 is the auto player and TTT_P2 takes the first empty cell
+{
+  int8_t p = TTT_P1;
+
+  T.setAutoPlayer(TTT_P1);
+  if (restart) T.start();
+  else if (T.getMoveCount() & 1) p = TTT_P2;
+  for (; !T.isGameOver(); p = -p)
+  {
+    uint8_t m = 0;
+
+    while (p == TTT_P2 && T.getBoardPosition(m) != TTT_P0)
+      m++;
+    T.doMove(m, p, true);
+  }
+}
+
+static void testLogSeed(void)
+// The log has the seed the game was played with, when the generator was 
+// never seeded and after a restore, so the game can be played again
+{
+  MD_TTT T(NULL), U(NULL);
+  uint8_t buf[TTT_SERIAL_SIZE], a[TTT_LOG_MAX_SIZE], b[TTT_LOG_MAX_SIZE];
+  tttGameResult r;
+  uint8_t n;
+
+  playAuto(T, true);
+  n = T.writeLog(a, sizeof(a));
+  CHECK(MD_TTT::replayLog(a, n, &r, 1) == 1);
+  CHECK(r.seed != 0);
+  U.setRandomState(r.seed);
+  playAuto(U, true);
+  CHECK(U.writeLog(b, sizeof(b)) == n && memcmp(a, b, n) == 0);
+
+  for (uint32_t g=1; g<=100; g++)
+  {
+    uint8_t m = g % TTT_BOARD_SIZE;
+
+    T.setSeed(g);
+    T.setAutoPlayer(TTT_P1);
+    T.start();
+    T.doMove(0, TTT_P1, true);
+    while (T.getBoardPosition(m) != TTT_P0)
+      m = (m + 1) % TTT_BOARD_SIZE;
+    T.doMove(m, TTT_P2, true);
+    T.serialize(buf, sizeof(buf));
+    CHECK(U.deserialize(buf, sizeof(buf), true));
+    playAuto(T, false);
+    playAuto(U, false);
+    n = T.writeLog(a, sizeof(a));
+    CHECK(U.writeLog(b, sizeof(b)) == n && memcmp(a, b, n) == 0);
+  }
+}
+#endif
+
+static void testHash(void)
+// The hash is the same for all the rotations and reflections of a board
+{
+  MD_TTT T(NULL);
+  uint32_t h;
+
+  play(T, "ab");
+  h = T.getBoardHash();
+  play(T, "cf");    // rotated
+  CHECK(T.getBoardHash() == h);
+  play(T, "gd");    // reflected
+  CHECK(T.getBoardHash() == h);
+  play(T, "ae");    // different
+  CHECK(T.getBoardHash() != h);
+}
+
+static void testBatch(void)
+// evalBoards() agrees with the game for the winner and takes a win for 
+// the player to move on each board
+{
+  tttBoard board[4];
+  uint8_t move[4];
+  int8_t winner[4];
+  int8_t player[4] = { TTT_P1, TTT_P1, TTT_P2, TTT_P1 };
+  MD_TTT T(NULL);
+  uint32_t rnd = 3;
+  uint32_t bad = 0;
+
+  board[0].p1 = 0x007; board[0].p2 = 0x018;  // TTT_P1 has the top row
+  board[1].p1 = 0x003; board[1].p2 = 0x018;  // TTT_P1 to move can win at c
+  board[2].p1 = 0x003; board[2].p2 = 0x018;  // TTT_P2 to move blocks or wins at f
+  board[3].p1 = 0x000; board[3].p2 = 0x000;  // empty
+  MD_TTT::evalBoards(board, 4, player, move, winner);
+  CHECK(winner[0] == TTT_P1);
+  CHECK(winner[1] == TTT_P0 && move[1] == 2);
+  CHECK(winner[2] == TTT_P0 && move[2] == 5);
+  CHECK(winner[3] == TTT_P0 && move[3] < TTT_BOARD_SIZE);
+
+  // worked out from the cells held: TTT_P2 holds fewer so moves next
+  board[2].p1 = 0x003; board[2].p2 = 0x008;
+  MD_TTT::evalBoards(&board[2], 1, NULL, &move[2], &winner[2]);
+  CHECK(winner[2] == TTT_P0 && move[2] == 2);
+
+  // worked out the same as given on random boards from games
+  for (uint16_t g=0; g<1000; g++)
+  {
+    uint8_t n = xorshift(rnd) % TTT_BOARD_SIZE;
+    tttBoard b;
+    uint8_t m[2];
+    int8_t w[2], p = TTT_P1;
+
+    play(T, "");
+    b.p1 = b.p2 = 0;
+    for (uint8_t i=0; i<n && !T.isGameOver(); i++, p = -p)
+    {
+      uint8_t c = randomCell(T, rnd);
+
+      T.doMove(c, p, true);
+      if (p == TTT_P1) b.p1 |= (1 << c); else b.p2 |= (1 << c);
+    }
+    MD_TTT::evalBoards(&b, 1, NULL, &m[0], &w[0]);
+    MD_TTT::evalBoards(&b, 1, &p, &m[1], &w[1]);
+    if (m[0] != m[1] || w[0] != w[1] || w[0] != T.getGameWinner())
+      bad++;
+  }
+  CHECK(bad == 0);
+}
+
+static void testLogReplay(void)
+// Finished games, moves after the end of a game, illegal cells and a 
+// damaged record, which ends the log
+{
+  static const uint8_t log[] =
+  {
+    0x05, 0x01, 0x01, 0x02, 0x03, 0x04, 0x10, 0x43, 0x06,  // TTT_P1 wins on adg
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x43, 0x76,  // ... then TTT_P2 moves at h
+    0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09,              // TTT_P2 first, off the board
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,              // the same cell twice
+    0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,              // format version 1
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,              // not reached
+  };
+  tttGameResult r[8];
+
+  CHECK(MD_TTT::replayLog(log, sizeof(log), r, ARRAY_SIZE(r)) == 4);
+  CHECK(r[0].valid && r[0].gameOver && r[0].winner == TTT_P1 && r[0].winLine == TTT_WL_V1);
+  CHECK(r[0].length == 9 && r[0].moves == 5 && r[0].seed == 0x04030201UL);
+  CHECK(r[0].autoPlayer == TTT_P1 && r[0].autoEngine == TTT_ENGINE_HEURISTIC);
+  CHECK(!r[1].valid && r[1].gameOver && r[1].winner == TTT_P1);
+  CHECK(!r[2].valid && !r[2].gameOver && r[2].length == 7);
+  CHECK(!r[3].valid && r[3].winner == TTT_P0);
+
+  // a record cut short ends the log, and only count results are written
+  CHECK(MD_TTT::replayLog(log, 8, r, ARRAY_SIZE(r)) == 0);
+  r[1].moves = 0xff;
+  CHECK(MD_TTT::replayLog(log, sizeof(log), r, 1) == 4);
+  CHECK(r[0].valid && r[1].moves == 0xff);
+  CHECK(MD_TTT::replayLog(log, sizeof(log), NULL, 0) == 4);
+}
+
+static void testAnalyze(void)
+// The moves are ranked as the heuristic auto player would choose them
+{
+  MD_TTT T(NULL);
+  tttMoveInfo m[TTT_BOARD_SIZE];
+  uint32_t rnd = 5;
+  uint32_t bad = 0;
+
+  // TTT_P1 wins at c
+  play(T, "adbe");
+  CHECK(T.analyze(TTT_P1, m, TTT_BOARD_SIZE) == 5);
+  CHECK(m[0].cell == 2 && m[0].mode == TTT_MODE_WIN && m[0].best);
+  CHECK(!m[1].best && m[1].value == TTT_VAL_UNKNOWN);
+  CHECK(T.analyze(TTT_P1, m, 1, true) == 5);      // only the best is returned
+  CHECK(m[0].cell == 2 && m[0].value == TTT_VAL_WIN);
+  CHECK(T.analyze(TTT_P0, m, TTT_BOARD_SIZE) == 0);
+  play(T, "adbec");
+  CHECK(T.analyze(TTT_P2, m, TTT_BOARD_SIZE) == 0); // the game is over
+
+  // Each histogram counts the 8 lines, the moves are in mode order with 
+  // the best first, and the auto player takes one of the best
+  for (uint16_t g=0; g<500; g++)
+  {
+    int8_t p = randomPosition(T, xorshift(rnd) % TTT_BOARD_SIZE, rnd);
+    uint8_t n, sum;
+
+    if (T.isGameOver())
+      continue;
+    n = T.analyze(p, m, TTT_BOARD_SIZE);
+    for (uint8_t i=0; i<n; i++)
+    {
+      sum = 0;
+      for (uint8_t j=0; j<ARRAY_SIZE(m[i].scores); j++)
+        sum += m[i].scores[j];
+      if (sum != TTT_WIN_LINES || (i > 0 && m[i].mode < m[i-1].mode))
+        bad++;
+      if (m[i].best != (i == 0 || m[i-1].best) && m[i].best)
+        bad++;
+    }
+#if !TTT_USE_BOOK
+    uint8_t c = autoMove(T, p, TTT_ENGINE_HEURISTIC);
+    uint8_t i = 0;
+
+    while (i < n && m[i].cell != c)
+      i++;
+    if (i == n || !m[i].best || m[i].mode != T.getAutoMode())
+      bad++;
+#endif
+  }
+  CHECK(bad == 0);
+}
+
+static void testDirty(void)
+// Only the cells that change are marked, and every change is counted
+{
+  MD_TTT T(NULL);
+  uint16_t g;
+
+  CHECK(T.getDirty() == 0x1ff);             // all dirty to start with
+  play(T, "ae");
+  T.clearDirty();
+  CHECK(T.getDirty() == 0);
+  g = T.getGeneration();
+  CHECK(T.doMove(2, TTT_P1, true));          // silent moves count too
+  CHECK(T.getDirty() == (1 << 2));
+  CHECK(T.getGeneration() == (uint16_t)(g + 1));
+  CHECK(!T.doMove(2, TTT_P2));               // not a move, so no change
+  CHECK(T.getDirty() == (1 << 2));
+  CHECK(T.getGeneration() == (uint16_t)(g + 1));
+  T.clearDirty();
+  CHECK(T.getGeneration() == (uint16_t)(g + 1));
+  T.start();                                 // only the occupied cells
+  CHECK(T.getDirty() == ((1 << 0) | (1 << 2) | (1 << 4)));
+  CHECK(T.getGeneration() == (uint16_t)(g + 2));
+#if TTT_USE_UNDO
+  play(T, "ae");
+  T.clearDirty();
+  CHECK(T.undoMove());
+  CHECK(T.getDirty() == (1 << 4));
+  T.clearDirty();
+  CHECK(T.redoMove());
+  CHECK(T.getDirty() == (1 << 4));
+#endif
+}
+
+#if TTT_USE_EVENTS && TTT_USE_UNDO
+static void testEvents(void)
+// Queued events, coalesced clears and lost events
+{
+  MD_TTT T(NULL);
+  uint8_t q[4];
+  tttEvent e;
+
+  CHECK(T.setEventQueue(q, sizeof(q)));
+  T.start();
+  T.start();
+  T.start();
+  CHECK(T.getEvent(&e) && e.type == TTT_EVT_CLEAR);
+  CHECK(!T.getEvent(&e));
+
+  // taking back a win, then a draw, puts the game in play again
+  T.setAutoPlayer(TTT_P0);
+  play(T, "adbec");
+  while (T.getEvent(&e)) {}
+  CHECK(T.undoMove());
+  CHECK(T.getEvent(&e) && e.type == TTT_EVT_CELL && e.pos == 2 && e.player == TTT_P0);
+  CHECK(T.getEvent(&e) && e.type == TTT_EVT_RESUME);
+  CHECK(!T.getEvent(&e));
+  play(T, "aebcfdgih");
+  while (T.getEvent(&e)) {}
+  CHECK(T.undoMove());
+  CHECK(T.getEvent(&e) && e.type == TTT_EVT_CELL);
+  CHECK(T.getEvent(&e) && e.type == TTT_EVT_RESUME);
+  CHECK(T.undoMove());
+  CHECK(T.getEvent(&e) && e.type == TTT_EVT_CELL);
+  CHECK(!T.getEvent(&e));
+
+  // a clear dropped from a full queue is not coalesced with the next one
+  T.start();
+  T.doMove(0, TTT_P1);
+  T.doMove(1, TTT_P2);
+  T.doMove(2, TTT_P1);   // the queue is now full
+  T.start();             // dropped
+  CHECK(T.getEvent(&e) && e.type == TTT_EVT_SYNC);
+  CHECK(!T.getEvent(&e));
+  T.start();
+  CHECK(T.getEvent(&e) && e.type == TTT_EVT_CLEAR);
+  CHECK(!T.getEvent(&e));
+
+  CHECK(!T.setEventQueue(q, 1));
+  CHECK(T.setEventQueue(NULL, 0));
+  CHECK(!T.getEvent(&e));
+}
+#endif
+
+#if TTT_USE_BOOK
+static void testBook(void)
+// The book gives the first move, and any book move keeps the best game
+// value for the player
+{
+  MD_TTT T(NULL);
+  int8_t value[TTT_BOARD_SIZE];
+  uint32_t rnd = 7;
+  uint32_t bad = 0, used = 0;
+
+  play(T, "");
+  CHECK(autoMove(T, TTT_P1, TTT_ENGINE_HEURISTIC) < TTT_BOARD_SIZE);
+  CHECK(T.getAutoMode() == TTT_MODE_BOOK);
+
+  for (uint16_t g=0; g<500; g++)
+  {
+    uint8_t n = xorshift(rnd) % TTT_BOARD_SIZE;
+    int8_t p = randomPosition(T, n, rnd);
+    int8_t best;
+    uint8_t c;
+
+    if (T.isGameOver())
+      continue;
+    best = moveValues(T, p, value);
+    c = autoMove(T, p, TTT_ENGINE_HEURISTIC);
+    if (T.getAutoMode() != TTT_MODE_BOOK)
+      continue;
+    used++;
+    if ((n > 2 && n < TTT_BOARD_SIZE - 4) || value[c] != best)
+      bad++;
+  }
+  CHECK(bad == 0 && used > 0);
+}
+#endif
+
+#if TTT_USE_TABLE
+static void testTable(void)
+// The table gives the game value found by the search, and a move that 
+// keeps it
+{
+  MD_TTT T(NULL);
+  int8_t value[TTT_BOARD_SIZE];
+  uint32_t rnd = 11;
+  uint32_t bad = 0;
+
+  play(T, "");
+  CHECK(T.getGameValue(TTT_P1) == TTT_VAL_DRAW);
+  play(T, "adbe");
+  CHECK(T.getGameValue(TTT_P1) == TTT_VAL_WIN);
+  CHECK(T.getGameValue(TTT_P2) == TTT_VAL_WIN);   // if it were TTT_P2 to move
+
+  for (uint16_t g=0; g<500; g++)
+  {
+    int8_t p = randomPosition(T, xorshift(rnd) % TTT_BOARD_SIZE, rnd);
+    int8_t best;
+    uint8_t c;
+
+    if (T.isGameOver())
+      continue;
+    best = moveValues(T, p, value);
+    if (T.getGameValue(p) != best)
+      bad++;
+    c = autoMove(T, p, TTT_ENGINE_TABLE);
+    if (T.getAutoMode() != TTT_MODE_TABLE || value[c] != best)
+      bad++;
+  }
+  CHECK(bad == 0);
+}
+#endif
+
+#if TTT_USE_STATS
+static void testStats(void)
+{
+  MD_TTT T(NULL);
+  tttStats st;
+
+  T.resetStats();
+  play(T, "ae");
+  T.setAutoPlayer(TTT_P1);
+  T.doMove(0, TTT_P1, true);
+  T.getStats(&st);
+  CHECK(st.calls == 1);
+#if !TTT_USE_BOOK
+  // a book move is not scored
+  CHECK(st.timeScore > 0 && st.timeScore < 1000000000ULL);
+#endif
+  T.resetStats();
+  T.getStats(&st);
+  CHECK(st.calls == 0 && st.timeScore == 0 && st.timeSelect == 0);
+}
+#endif
+
+#if TTT_USE_STEP
+static void testStep(void)
+// The time-sliced search finds the move doMove() would, the other 
+// engines are ready at once, and a change to the board drops the move
+{
+  MD_TTT T(NULL), U(NULL);
+  uint32_t rnd = 13;
+  uint32_t bad = 0;
+
+  play(T, "");
+  CHECK(!T.beginAutoMove());                 // no auto player
+  CHECK(T.getAutoMove() == 0xff);
+
+  T.setAutoPlayer(TTT_P1, TTT_ENGINE_SEARCH);
+  CHECK(T.beginAutoMove());
+  CHECK(!T.stepAutoMove(0));                 // a slice does not search it all
+  CHECK(!T.isMoveReady() && T.getAutoMove() == 0xff);
+  T.doMove(4, TTT_P2, true);
+  CHECK(!T.stepAutoMove(0) && !T.isMoveReady());
+
+  play(T, "ae");
+  T.setAutoPlayer(TTT_P1);
+  CHECK(T.beginAutoMove() && T.isMoveReady());
+  uint8_t c = T.getAutoMove();
+
+  CHECK(c < TTT_BOARD_SIZE && T.doMove(0, TTT_P1, true) && T.getBoardPosition(c) == TTT_P1);
+  play(T, "adbec");
+  T.setAutoPlayer(TTT_P2);
+  CHECK(!T.beginAutoMove());                 // the game is over
+
+#if TTT_USE_HASH
+  static tttTransEntry tt[2][256];
+
+  T.setTransTable(tt[0], sizeof(tt[0]));
+  U.setTransTable(tt[1], sizeof(tt[1]));
+#endif
+  for (uint16_t g=0; g<200; g++)
+  {
+    uint8_t n = xorshift(rnd) % (TTT_BOARD_SIZE - 1);
+    uint32_t r = rnd;
+    int8_t p = randomPosition(T, n, rnd);
+    uint32_t slices = 0;
+
+    randomPosition(U, n, r);
+    if (T.isGameOver())
+      continue;
+    T.setAutoPlayer(p, TTT_ENGINE_SEARCH);
+    T.beginAutoMove();
+    while (!T.stepAutoMove(5) && slices < 100000)
+      slices++;
+    c = T.getAutoMove();
+    T.doMove(0, p, true);
+    if (c >= TTT_BOARD_SIZE || T.getBoardPosition(c) != p || autoMove(U, p, TTT_ENGINE_SEARCH) != c)
+      bad++;
+  }
+  CHECK(bad == 0);
+}
+#endif
+
+template <uint8_t R, uint8_t C, uint8_t K>
+class TestMNK : public MD_TTT_MNK<R, C, K>
+{
+  typedef MD_TTT_MNK<R, C, K> G;
+
+  public:
+  TestMNK(void) : G(NULL) {}
+
+  bool cellLinesOk(void)
+  // the table has each line through each cell once, then NO_LINE
+  {
+    for (uint16_t k=0; k<G::BOARD_SIZE; k++)
+    {
+      uint8_t n = 0;
+
+      for (uint16_t l=0; l<G::WIN_LINES; l++)
+      {
+        bool found = false;
+
+        for (uint8_t j=0; j<G::CELL_LINES; j++)
+          found |= (G::cellLine(k, j) == l);
+        if (found != G::inLine(k, l))
+          return(false);
+        n += found;
+      }
+      if (n < G::CELL_LINES && G::cellLine(k, n) != G::NO_LINE)
+        return(false);
+    }
+
+    return(true);
+  }
+
+  bool playSelf(void)
+  // the auto player finishes a game against itself with legal moves
+  {
+    int8_t p = TTT_P1;
+
+    this->start();
+    while (!this->isGameOver())
+    {
+      this->setAutoPlayer(p);
+      if (!this->doMove(0, p))
+        return(false);
+      p = -p;
+    }
+
+    return(true);
+  }
+
+  bool wideScores(void) { return(sizeof(typename G::score_t) > sizeof(int32_t)); }
+
+  bool takesWin(void)
+  // TTT_P1 takes its win with K-1 in the top row rather than block the 
+  // K-1 of TTT_P2 further down
+  {
+    this->start();
+    this->setAutoPlayer(TTT_P0);
+    for (uint8_t i=0; i<K-1; i++)
+    {
+      this->doMove(i, TTT_P1);
+      this->doMove(4 * C + i, TTT_P2);
+    }
+    this->setAutoPlayer(TTT_P1);
+    this->doMove(0, TTT_P1);
+
+    return(this->getGameWinner() == TTT_P1 && this->getBoardPosition(K - 1) == TTT_P1);
+  }
+};
+
+static void testMNK(void)
+{
+  TestMNK<3, 3, 3> T3;
+  TestMNK<4, 4, 4> T4;
+  TestMNK<5, 5, 3> T5;
+  TestMNK<6, 7, 4> T67;
+  TestMNK<15, 15, 5> T15;
+  TestMNK<12, 12, 10> T12;
+
+  CHECK(T3.cellLinesOk());
+  CHECK(T4.cellLinesOk());
+  CHECK(T5.cellLinesOk());
+  CHECK(T67.cellLinesOk());
+  CHECK(T15.cellLinesOk());
+  CHECK(T12.cellLinesOk());
+
+  // the line scores for K=10 need 64 bits to stay below a win
+  CHECK(!T15.wideScores());
+  CHECK(T12.wideScores());
+  T12.setSearchDepth(2);
+  CHECK(T12.takesWin());
+  CHECK(T15.takesWin());
+
+  // perfect play on the classic board is a draw
+  CHECK(T3.playSelf());
+  CHECK(T3.getGameWinner() == TTT_P0);
+  T4.setSearchDepth(4);
+  CHECK(T4.playSelf());
+  CHECK(T5.playSelf());
+
+  T4.start();
+  T4.setAutoPlayer(TTT_P0);
+  CHECK(!T4.doMove(0, TTT_P0));
+  CHECK(!T4.doMove(0, 2));
+  CHECK(T4.doMove(0, TTT_P1));
+  CHECK(T4.getBoardPosition(0) == TTT_P1);
+}
+
+static void testPool(void)
+{
+  static uint8_t mem[16 * TTT_POOL_GAME_SIZE + 64];
+  MD_TTTPool P(mem, sizeof(mem));
+  tttHandle h = P.acquire();
+
+  CHECK(h != TTT_POOL_NONE);
+  CHECK(P.doMove(h, 0, TTT_P1));
+  CHECK(!P.doMove(h, 0, TTT_P2));
+  CHECK(P.doMove(h, 3, TTT_P2));
+  CHECK(P.doMove(h, 1, TTT_P1));
+  CHECK(P.doMove(h, 4, TTT_P2));
+  CHECK(P.doMove(h, 2, TTT_P1));
+  CHECK(P.isGameOver(h));
+  CHECK(P.getGameWinner(h) == TTT_P1);
+  CHECK(P.getWinLine(h) == TTT_WL_H1);
+  CHECK(!P.doMove(h, 5, TTT_P2));           // the game is over
+  CHECK(P.release(h));
+  CHECK(!P.release(h));
+  CHECK(!P.doMove(h, 0, TTT_P1));
+
+  // the last move makes H1 and V1, and both report the higher line
+  const char *moves = "becfdhgia";
+  MD_TTT T(NULL);
+  int8_t p = TTT_P1;
+
+  play(T, moves);
+  h = P.acquire();
+  for (const char *m = moves; *m != '\0'; m++, p = -p)
+    CHECK(P.doMove(h, *m - 'a', p));
+  CHECK(T.getGameWinner() == TTT_P1 && P.getGameWinner(h) == TTT_P1);
+  CHECK(T.getWinLine() == TTT_WL_V1);
+  CHECK(P.getWinLine(h) == T.getWinLine());
+  CHECK(P.release(h));
+}
+
+static uint16_t poolMoves = 0, poolBatches = 0, poolBatchCount = 0;
+
+static void poolMoveHandler(tttHandle h, uint8_t pos, int8_t player)
+{
+  (void)h; (void)pos; (void)player;
+  poolMoves++;
+}
+
+static void poolBatchHandler(const tttPoolMove *moves, uint16_t count)
+{
+  (void)moves;
+  poolBatches++;
+  poolBatchCount = count;
+}
+
+static void testPoolBatch(void)
+// doMoves() makes the moves in order, sets the cell and the result of 
+// each, and calls back for each move made or once for the batch
+{
+  static uint8_t mem[4 * TTT_POOL_GAME_SIZE + 64];
+  MD_TTTPool P(mem, sizeof(mem), poolMoveHandler);
+  tttHandle a = P.acquire(), b = P.acquire();
+  tttPoolMove m[6] =
+  {
+    { a, 0, TTT_P1, 0xff },
+    { b, 4, TTT_P1, 0xff },
+    { a, 0, TTT_P2, 0xff },             // occupied
+    { a, 3, TTT_P2, 0xff },
+    { b, 0, TTT_P2, 0xff },             // the auto player chooses
+    { TTT_POOL_NONE, 0, TTT_P1, 0xff }, // not a game
+  };
+
+  P.setAutoPlayer(b, TTT_P2);
+  CHECK(P.doMoves(m, ARRAY_SIZE(m)) == 4);
+  CHECK(m[0].result == TTT_POOL_MOVED && m[1].result == TTT_POOL_MOVED);
+  CHECK(m[2].result == TTT_POOL_ERROR && m[5].result == TTT_POOL_ERROR);
+  CHECK(m[3].result == TTT_POOL_MOVED && P.getBoardPosition(a, 3) == TTT_P2);
+  CHECK(m[4].result == TTT_POOL_MOVED && m[4].pos != 4 && P.getBoardPosition(b, m[4].pos) == TTT_P2);
+  CHECK(poolMoves == 4 && poolBatches == 0);
+
+  // TTT_P1 takes the top row of game a
+  tttPoolMove w[3] = { { a, 1, TTT_P1, 0xff }, { a, 4, TTT_P2, 0xff }, { a, 2, TTT_P1, 0xff } };
+
+  P.setBatchHandler(poolBatchHandler);
+  CHECK(P.doMoves(w, ARRAY_SIZE(w)) == 3);
+  CHECK(w[1].result == TTT_POOL_MOVED && w[2].result == TTT_POOL_OVER);
+  CHECK(P.isGameOver(a) && P.getGameWinner(a) == TTT_P1);
+  CHECK(poolBatches == 1 && poolBatchCount == 3 && poolMoves == 4);
+  w[0].pos = 5;
+  CHECK(P.doMoves(w, 1, true) == 0);        // the game is over
+  CHECK(w[0].result == TTT_POOL_ERROR && poolBatches == 1);
+}
+
+int main(void)
+{
+  testMoves();
+  testWins();
+  testHeuristic();
+  testSearch();
+#if TTT_USE_UNDO
+  testUndo();
+  testSerialize();
+  testSerializeInvalid();
+  testLogSeed();
+#endif
+  testHash();
+  testBatch();
+  testLogReplay();
+  testAnalyze();
+  testDirty();
+#if TTT_USE_EVENTS && TTT_USE_UNDO
+  testEvents();
+#endif
+  testPool();
+  testPoolBatch();
+  testMNK();
+#if TTT_USE_BOOK
+  testBook();
+#endif
+#if TTT_USE_TABLE
+  testTable();
+#endif
+#if TTT_USE_STEP
+  testStep();
+#endif
+#if TTT_USE_STATS
+  testStats();
+#endif
+
+  printf("MD_TTT tests: %u checks, %u failed\n", checks, failures);
+
+  return(failures == 0 ? 0 : 1);
+}
@@ -0,0 +1,269 @@
+// Self play tournament for the MD_TTT library auto player engines
+//
+// Plays a large number of games between pairs of players (the auto
+// player engines and a random player) to measure the strength of the
+// engines and how fast games can be played. The games are shared out
+// between a number of threads, each with its own MD_TTT object.
+// This is a host (PC) program, not an Arduino sketch. From the library
+// folder
+//
+//   g++ -O2 -pthread -DTTT_USE_HASH=1 -Isrc -o Tournament tools/MD_TTT_Tournament.cpp src/*.cpp
+//   ./Tournament [-g games] [-t threads] [-s seed] [-x]
+//
+//   -g  number of games for each match (default 100000)
+//   -t  number of threads (default all the processor cores)
+//   -s  seed for the random choices (default 1)
+//   -x  play the tournament with 1, 2, 4, ... threads up to -t and
+//       report how the games/s scale with the number of threads
+//
+// For each match the program reports the percentage of games won by
+// each player and drawn and, for the heuristic engine, the percentage
+// of its moves selected by each tryMode (TTT_MODE_*) and, if TTT_USE_BOOK
+// is set, from the opening book, followed by the
+// games played per second for the whole tournament. The games are played in blocks of CHUNK_GAMES
+// and each block starts from its own seed, so the results for a seed
+// are the same whatever the number of threads.
+//
+#include <MD_TTT.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#define CHUNK_GAMES   1000  // games in each block of work
+#define RANDOM_PLAYER 0xff  // engine id for the random player
+#define MODES         (TTT_MODE_FIRST + 1)  // heuristic modes counted
+#define BOOK          MODES                 // the modes[] count for book moves
+
+struct Player
+{
+  const char *name;
+  uint8_t engine;   // TTT_ENGINE_* or RANDOM_PLAYER
+};
+
+static const Player players[] =
+{
+  { "heuristic", TTT_ENGINE_HEURISTIC },
+  { "random", RANDOM_PLAYER },
+  { "search", TTT_ENGINE_SEARCH },
+#if TTT_USE_TABLE
+  { "table", TTT_ENGINE_TABLE },
+#endif
+};
+
+// The matches in the tournament, as indices into players[]. The first
+// player is TTT_P1 and always moves first.
+static const uint8_t matches[][2] =
+{
+  { 0, 0 }, // heuristic v heuristic
+  { 0, 1 }, // heuristic v random
+  { 1, 0 }, // random v heuristic
+  { 0, 2 }, // heuristic v search
+  { 2, 0 }, // search v heuristic
+  { 2, 1 }, // search v random
+  { 1, 2 }, // random v search
+#if TTT_USE_TABLE
+  { 0, 3 }, // heuristic v table
+  { 3, 0 }, // table v heuristic
+#endif
+};
+
+#define MATCH_COUNT (sizeof(matches) / sizeof(matches[0]))
+
+struct Result
+{
+  uint32_t games;
+  uint32_t wins[3];         // indexed by winner + 1, so [1] is draws
+  uint32_t modes[MODES+1];  // heuristic moves selected by each tryMode, and from the book
+};
+
+static uint32_t xorshift(uint32_t &x)
+{
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+
+  return(x);
+}
+
+static void playChunk(MD_TTT &T, tttTransEntry *tt, size_t ttSize, const uint8_t match[2], uint32_t seed, uint32_t games, Result &r)
+// Play a block of games for the match, adding the results to r
+{
+  uint32_t rnd = seed * 0x9e3779b9UL + 1;
+
+  T.setSeed(seed);
+#if TTT_USE_HASH
+  T.setTransTable(tt, ttSize);   // also clears the table
+#endif
+
+  for (uint32_t g=0; g<games; g++)
+  {
+    int8_t p = TTT_P1;
+
+    T.start();
+    while (!T.isGameOver())
+    {
+      uint8_t engine = players[match[p == TTT_P1 ? 0 : 1]].engine;
+
+      if (engine == RANDOM_PLAYER)
+      {
+        uint8_t m;
+
+        do
+          m = xorshift(rnd) % TTT_BOARD_SIZE;
+        while (T.getBoardPosition(m) != TTT_P0);
+
+        T.setAutoPlayer(TTT_P0);
+        T.doMove(m, p, true);
+      }
+      else
+      {
+        T.setAutoPlayer(p, engine);
+        T.doMove(0, p, true);
+        if (engine == TTT_ENGINE_HEURISTIC && T.getAutoMode() < MODES)
+          r.modes[T.getAutoMode()]++;
+        else if (engine == TTT_ENGINE_HEURISTIC && T.getAutoMode() == TTT_MODE_BOOK)
+          r.modes[BOOK]++;
+      }
+      p = -p;
+    }
+    r.games++;
+    r.wins[T.getGameWinner() + 1]++;
+  }
+}
+
+static double playTournament(uint32_t gamesPerMatch, uint8_t threads, uint32_t seed, Result results[MATCH_COUNT])
+// Play all the matches using the number of threads and return the
+// time taken in seconds.
+{
+  const uint32_t chunksPerMatch = (gamesPerMatch + CHUNK_GAMES - 1) / CHUNK_GAMES;
+  const uint32_t chunks = chunksPerMatch * MATCH_COUNT;
+  std::atomic<uint32_t> nextChunk(0);
+  std::vector<std::vector<Result> > local(threads, std::vector<Result>(MATCH_COUNT));
+  std::vector<std::thread> pool;
+  std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  // Each thread takes the next block of games until there are none left,
+  // so the faster threads take more of the work.
+  for (uint8_t t=0; t<threads; t++)
+  {
+    pool.push_back(std::thread([&, t]()
+    {
+      MD_TTT T(NULL);
+      static thread_local tttTransEntry tt[512];
+      uint32_t c;
+
+      for (uint8_t i=0; i<MATCH_COUNT; i++)
+        memset(&local[t][i], 0, sizeof(Result));
+
+      while ((c = nextChunk++) < chunks)
+      {
+        uint32_t m = c / chunksPerMatch;
+        uint32_t first = (c % chunksPerMatch) * CHUNK_GAMES;
+        uint32_t games = (gamesPerMatch - first < CHUNK_GAMES) ? gamesPerMatch - first : CHUNK_GAMES;
+
+        playChunk(T, tt, sizeof(tt), matches[m], seed + c, games, local[t][m]);
+      }
+    }));
+  }
+
+  for (uint8_t t=0; t<threads; t++)
+    pool[t].join();
+
+  // add up the results from each thread
+  memset(results, 0, sizeof(Result) * MATCH_COUNT);
+  for (uint8_t t=0; t<threads; t++)
+  {
+    for (uint8_t m=0; m<MATCH_COUNT; m++)
+    {
+      results[m].games += local[t][m].games;
+      for (uint8_t i=0; i<3; i++)
+        results[m].wins[i] += local[t][m].wins[i];
+      for (uint8_t i=0; i<=MODES; i++)
+        results[m].modes[i] += local[t][m].modes[i];
+    }
+  }
+
+  return(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+}
+
+static void printResults(const Result results[MATCH_COUNT], double time)
+{
+  uint32_t total = 0;
+
+  printf("%-24s %9s %7s %7s %7s  tryMode %% (0 1 2 3 4 5%s)\n", "P1 v P2", "games", "P1 %", "draw %", "P2 %", TTT_USE_BOOK ? " book" : "");
+  for (uint8_t m=0; m<MATCH_COUNT; m++)
+  {
+    const Result &r = results[m];
+    char name[40];
+    uint32_t moves = 0;
+
+    snprintf(name, sizeof(name), "%s v %s", players[matches[m][0]].name, players[matches[m][1]].name);
+    printf("%-24s %9u %7.2f %7.2f %7.2f ", name, r.games,
+      100.0 * r.wins[TTT_P1 + 1] / r.games, 100.0 * r.wins[TTT_P0 + 1] / r.games, 100.0 * r.wins[TTT_P2 + 1] / r.games);
+
+    for (uint8_t i=0; i<=MODES; i++)
+      moves += r.modes[i];
+    if (moves != 0)
+    {
+      for (uint8_t i=0; i<(TTT_USE_BOOK ? MODES+1 : MODES); i++)
+        printf(" %5.1f", 100.0 * r.modes[i] / moves);
+    }
+    printf("\n");
+    total += r.games;
+  }
+
+  printf("\n%u games in %.2f s, %.0f games/s\n", total, time, total / time);
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t games = 100000;
+  uint32_t seed = 1;
+  uint8_t threads = std::thread::hardware_concurrency();
+  bool scaling = false;
+  Result results[MATCH_COUNT];
+
+  for (int i=1; i<argc; i++)
+  {
+    if (strcmp(argv[i], "-g") == 0 && i+1 < argc) games = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-t") == 0 && i+1 < argc) threads = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-s") == 0 && i+1 < argc) seed = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-x") == 0) scaling = true;
+    else
+    {
+      fprintf(stderr, "usage: %s [-g games] [-t threads] [-s seed] [-x]\n", argv[0]);
+      return(1);
+    }
+  }
+  if (threads == 0) threads = 1;
+  if (games == 0) games = 1;
+
+  printf("MD_TTT tournament, %u games per match, %u threads, seed %u\n\n", games, threads, seed);
+
+  if (!scaling)
+  {
+    double time = playTournament(games, threads, seed, results);
+
+    printResults(results, time);
+  }
+  else
+  {
+    double base = 0;
+
+    printf("%8s %12s %8s\n", "threads", "games/s", "speedup");
+    for (uint16_t t=1; t<=threads; t = (t < threads && t*2 > threads) ? threads : t*2)
+    {
+      double time = playTournament(games, t, seed, results);
+      double gps = games * MATCH_COUNT / time;
+
+      if (t == 1) base = gps;
+      printf("%8u %12.0f %8.2f\n", t, gps, gps / base);
+    }
+  }
+
+  return(0);
+}
@@ -0,0 +1,367 @@
+// Exhaustive check of the MD_TTT heuristic auto player
+//
+// Finds every board where the heuristic auto player (doAutoMove() with
+// TTT_ENGINE_HEURISTIC) can choose a move that is worse than the game
+// value, ie where a won game can be drawn or lost, or a drawn game lost,
+// against a perfect opponent. Every board that can be reached in a game
+// is checked twice, once with TTT_P1 moving first and once with the
+// players swapped, which must give the same moves.
+//
+// The random tie breaks are not sampled. A tie break can select any of
+// the cells tied for the best score, so the cells are all found by
+// calling selectMove() with the same scores as doAutoMove(), taking out
+// each cell it returns in turn until it has returned all the tied cells.
+// As a check, doAutoMove() itself is then called from a number of random
+// generator states and must only return cells from that set. The game
+// value of each move is worked out by a negamax search of this program's
+// own, not by the library.
+// This is a host (PC) program, not an Arduino sketch. From the library
+// folder
+//
+//   g++ -O2 -pthread -Isrc -o Verify tools/MD_TTT_Verify.cpp src/*.cpp
+//   ./Verify [-t threads] [-r states] [-q]
+//
+//   -t  number of threads (default all the processor cores)
+//   -r  random generator states to call doAutoMove() from (default 16)
+//   -q  only print the counts, not the list of boards
+//
+// The list shows each board with the player to move as X, the moves the
+// heuristic chooses between, the heuristic mode (TTT_MODE_*) and the game
+// value of each move for X (+ win, = draw, - loss). The program exits with
+// a non-zero status if the counts are not the KNOWN_* values below, so it
+// can be run as a test. Change them when the heuristic is changed on
+// purpose.
+//
+#include <MD_TTT.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#define KEYS  19683   // 3^9 board keys
+#define BOARD_MASK    0x1ff   // all the cells of a bitboard
+#define CELL_MASK(i)  ((uint16_t)1 << (i))
+
+// the expected counts for the heuristic engine
+#define KNOWN_BOARDS   4520  // boards where the game is not over
+#define KNOWN_DROPS      98  // boards where a move can be worse than the game value
+#define KNOWN_LOSSES     50  // of which a move can lose the game
+
+// The cells in each winning line as a bitboard mask
+static const uint16_t wlm[] =
+{
+  0b100010001, 0b000000111, 0b000111000, 0b111000000,
+  0b001001001, 0b010010010, 0b100100100, 0b001010100
+};
+
+static const uint16_t pow3[TTT_BOARD_SIZE] = { 1, 3, 9, 27, 81, 243, 729, 2187, 6561 };
+
+static int8_t solved[KEYS];  // game value for the player to move, by the key of the board seen by them
+
+// Access to the protected auto player move selection
+class VerifyTTT : public MD_TTT
+{
+public:
+  VerifyTTT(void) : MD_TTT(NULL) {}
+  uint8_t autoMove(int8_t player) { return(doAutoMove(player)); }
+
+  uint16_t choices(int8_t player, uint8_t *pMode)
+  // All the cells doAutoMove() can select for player, for any state of
+  // the random generator. Returns 0 if the tied cells are not as expected.
+  {
+    uint16_t empty = ~(_boardP1 | _boardP2) & BOARD_MASK;
+    uint16_t cells = 0;
+    uint8_t ties, n, mode;
+#if TTT_USE_SCORES
+    uint8_t (*scores)[7] = _scores[player == TTT_P1 ? 0 : 1];
+#else
+    uint8_t scores[TTT_BOARD_SIZE][7];
+
+    boardScores(scores, player);
+#endif
+
+#if TTT_USE_BOOK
+    uint16_t book = bookMoves(player);
+
+    if (book != 0)
+    {
+      *pMode = TTT_MODE_BOOK;
+      return(book);
+    }
+#endif
+
+    // The first call gives the mode and the number of tied cells. Taking
+    // out the cell it returns leaves the rest of the ties for the same mode.
+    n = selectMove(scores, empty, NULL, pMode, &ties);
+    for (uint8_t i=1; ; i++)
+    {
+      cells |= CELL_MASK(n);
+      empty &= ~CELL_MASK(n);
+      if (i == ties)
+        break;
+
+      uint8_t t;
+
+      n = selectMove(scores, empty, NULL, &mode, &t);
+      if (mode != *pMode || t != ties - i)
+        return(0);
+    }
+
+    return(cells);
+  }
+};
+
+struct Board
+{
+  uint16_t me, opp;   // the cells of the player to move and the opponent
+};
+
+struct Check
+{
+  uint16_t cells;       // the cells the heuristic can choose
+  uint16_t drop;        // the cells worse than the game value
+  uint8_t  mode;        // the heuristic mode that chose them
+  int8_t   value[TTT_BOARD_SIZE];  // game value of each move for the player to move
+  int8_t   best;        // game value of the board for the player to move
+  bool     error;       // the choices were not consistent
+};
+
+static double now(void)
+// seconds from an arbitrary start
+{
+  return(std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+static bool isWin(uint16_t b)
+// true if the bitboard has a complete line
+{
+  for (uint8_t i=0; i<sizeof(wlm)/sizeof(wlm[0]); i++)
+    if ((b & wlm[i]) == wlm[i])
+      return(true);
+
+  return(false);
+}
+
+static uint16_t key(uint16_t me, uint16_t opp)
+// the base 3 key of the board seen by the player to move
+{
+  uint16_t k = 0;
+
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+    k += pow3[i] * ((me >> i) & 1 ? 1 : ((opp >> i) & 1 ? 2 : 0));
+
+  return(k);
+}
+
+static int8_t solve(uint16_t me, uint16_t opp)
+// Game value for the player to move with perfect play from both sides
+{
+  uint16_t k = key(me, opp);
+
+  if (solved[k] != TTT_VAL_UNKNOWN)
+    return(solved[k]);
+
+  int8_t v = TTT_VAL_LOSS;
+
+  if (isWin(opp))
+    v = TTT_VAL_LOSS;
+  else if ((me | opp) == BOARD_MASK)
+    v = TTT_VAL_DRAW;
+  else
+  {
+    for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+    {
+      if ((me | opp) & CELL_MASK(i))
+        continue;
+
+      int8_t cv = -solve(opp, me | CELL_MASK(i));
+
+      if (cv > v) v = cv;
+    }
+  }
+  solved[k] = v;
+
+  return(v);
+}
+
+static void findBoards(uint16_t me, uint16_t opp, std::vector<bool> &seen, std::vector<Board> &boards)
+// Every board that can be reached in a game where the game is not over
+{
+  uint16_t k = key(me, opp);
+
+  if (seen[k] || isWin(opp) || (me | opp) == BOARD_MASK)
+    return;
+
+  seen[k] = true;
+  boards.push_back({ me, opp });
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+    if (!((me | opp) & CELL_MASK(i)))
+      findBoards(opp, me | CELL_MASK(i), seen, boards);
+}
+
+static void checkBoard(VerifyTTT &T, const Board &b, int8_t first, uint32_t states, Check &c)
+// Set up the board with first moving first and work out all the moves
+// the heuristic can make on it.
+{
+  uint8_t  n = __builtin_popcount(b.me | b.opp);
+  int8_t   player = (n & 1) ? -first : first;
+  uint16_t p1 = (player == TTT_P1 ? b.me : b.opp);
+  uint16_t p2 = (player == TTT_P1 ? b.opp : b.me);
+  uint16_t cells[2] = { first == TTT_P1 ? p1 : p2, first == TTT_P1 ? p2 : p1 };
+
+  // alternate the players' cells, the game is not over on any part of the board
+  T.start();
+  for (uint8_t i=0; i<n; i++)
+  {
+    uint16_t &m = cells[i & 1];
+
+    T.doMove(__builtin_ctz(m), (i & 1) ? -first : first, true);
+    m &= m - 1;
+  }
+
+  memset(&c, 0, sizeof(c));
+  c.cells = T.choices(player, &c.mode);
+  c.error = (c.cells == 0);
+  c.best = solve(b.me, b.opp);
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+  {
+    if ((b.me | b.opp) & CELL_MASK(i))
+      continue;
+
+    c.value[i] = -solve(b.opp, b.me | CELL_MASK(i));
+    if ((c.cells & CELL_MASK(i)) && c.value[i] < c.best)
+      c.drop |= CELL_MASK(i);
+  }
+
+  // the library's own move must be one of them
+  for (uint32_t s=1; s<=states; s++)
+  {
+    T.setRandomState(s * 0x9e3779b9UL);
+    if (!(c.cells & CELL_MASK(T.autoMove(player))))
+      c.error = true;
+  }
+}
+
+static void printBoard(const Board &b, const Check &c)
+{
+  static const char value[] = "-=+";
+
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+  {
+    if (i != 0 && i % 3 == 0)
+      putchar('/');
+    putchar(b.me & CELL_MASK(i) ? 'X' : (b.opp & CELL_MASK(i) ? 'O' : '.'));
+  }
+  printf("  value %c  mode %u  moves", value[c.best + 1], c.mode);
+  for (uint8_t i=0; i<TTT_BOARD_SIZE; i++)
+    if (c.cells & CELL_MASK(i))
+      printf(" %c%c%s", 'a' + i, value[c.value[i] + 1], c.drop & CELL_MASK(i) ? "!" : "");
+  printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+  uint32_t threads = std::thread::hardware_concurrency();
+  uint32_t states = 16;
+  bool quiet = false;
+
+  for (int i=1; i<argc; i++)
+  {
+    if (strcmp(argv[i], "-t") == 0 && i+1 < argc) threads = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-r") == 0 && i+1 < argc) states = strtoul(argv[++i], NULL, 10);
+    else if (strcmp(argv[i], "-q") == 0) quiet = true;
+    else
+    {
+      fprintf(stderr, "usage: %s [-t threads] [-r states] [-q]\n", argv[0]);
+      return(1);
+    }
+  }
+  if (threads == 0) threads = 1;
+
+  double start = now();
+  std::vector<bool> seen(KEYS);
+  std::vector<Board> boards;
+
+  memset(solved, TTT_VAL_UNKNOWN, sizeof(solved));
+  findBoards(0, 0, seen, boards);
+  for (uint32_t i=0; i<boards.size(); i++)
+    solve(boards[i].me, boards[i].opp);   // the table is only read by the threads
+
+  // Check the boards, each thread taking the next block until there are none left
+  std::vector<Check> check(boards.size());
+  std::atomic<uint32_t> next(0), errors(0);
+  std::vector<std::thread> pool;
+  const uint32_t block = 64;
+
+  for (uint32_t n=0; n<threads; n++)
+  {
+    pool.push_back(std::thread([&]()
+    {
+      VerifyTTT T;
+      Check swapped;
+      uint32_t i;
+
+      while ((i = next.fetch_add(block)) < boards.size())
+      {
+        for (uint32_t j=i; j<i+block && j<boards.size(); j++)
+        {
+          checkBoard(T, boards[j], TTT_P1, states, check[j]);
+          checkBoard(T, boards[j], TTT_P2, states, swapped);
+          if (check[j].error || swapped.error || swapped.cells != check[j].cells || swapped.mode != check[j].mode)
+            errors++;
+        }
+      }
+    }));
+  }
+  for (uint32_t n=0; n<threads; n++)
+    pool[n].join();
+
+  // report the boards where a move is worse than the game value
+  uint32_t drops = 0, losses = 0, choices = 0;
+  uint32_t modeDrops[TTT_MODES] = { 0 };
+
+  if (!quiet)
+    printf("Boards where the heuristic can do worse than the game value\n\n");
+  for (uint32_t i=0; i<boards.size(); i++)
+  {
+    Check &c = check[i];
+
+    choices += __builtin_popcount(c.cells);
+    if (c.drop == 0)
+      continue;
+
+    drops++;
+    if (c.mode < TTT_MODES)
+      modeDrops[c.mode]++;
+    for (uint8_t j=0; j<TTT_BOARD_SIZE; j++)
+      if ((c.drop & CELL_MASK(j)) && c.value[j] == TTT_VAL_LOSS)
+      {
+        losses++;
+        break;
+      }
+    if (!quiet)
+      printBoard(boards[i], c);
+  }
+
+  printf("%sMD_TTT heuristic check, %u threads, %.3f s\n\n", quiet ? "" : "\n", threads, now() - start);
+  printf("Boards checked      %6u, with TTT_P1 and with TTT_P2 moving first\n", (uint32_t)boards.size());
+  printf("Moves chosen from   %6u, %.2f for each board\n", choices, (double)choices / boards.size());
+  printf("Worse than value    %6u boards, %u can lose the game\n", drops, losses);
+  printf("By mode            ");
+  for (uint8_t i=0; i<TTT_MODES; i++)
+    if (modeDrops[i] != 0)
+      printf(" %u:%u", i, modeDrops[i]);
+  printf("\n");
+  printf("Errors              %6u\n", (uint32_t)errors);
+
+  if (errors != 0 || boards.size() != KNOWN_BOARDS || drops != KNOWN_DROPS || losses != KNOWN_LOSSES)
+  {
+    printf("\nThe results are not the known ones!\n");
+    return(1);
+  }
+
+  return(0);
+}